@@ -0,0 +1,45 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef GSCALARSUMSIACLUSTERDENSITY_H
+#define GSCALARSUMSIACLUSTERDENSITY_H
+
+#include "AuxScalarKernel.h"
+#include "GGroup.h"
+
+//Forward Declarations
+class GScalarSumSIAClusterDensity;
+
+template<>
+InputParameters validParams<GScalarSumSIAClusterDensity>();
+
+/**
+ * GSumSIAClusterDensity for SCALAR group variables.
+ */
+class GScalarSumSIAClusterDensity : public AuxScalarKernel
+{
+public:
+  GScalarSumSIAClusterDensity(const InputParameters & parameters);
+
+protected:
+  virtual Real computeValue();
+
+  const GGroup & _gc;
+  Real _scale_factor;
+  int _lower_bound;
+  int _upper_bound;
+  std::vector<const VariableValue *> _val_vars;
+  std::vector<Real> _coef;
+};
+#endif
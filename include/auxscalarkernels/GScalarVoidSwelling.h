@@ -0,0 +1,42 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef GSCALARVOIDSWELLING_H
+#define GSCALARVOIDSWELLING_H
+
+#include "AuxScalarKernel.h"
+#include "GGroup.h"
+
+//Forward Declarations
+class GScalarVoidSwelling;
+
+template<>
+InputParameters validParams<GScalarVoidSwelling>();
+
+/**
+ * GVoidSwelling for SCALAR group variables.
+ */
+class GScalarVoidSwelling : public AuxScalarKernel
+{
+public:
+  GScalarVoidSwelling(const InputParameters & parameters);
+
+protected:
+  virtual Real computeValue();
+
+  const GGroup & _gc;
+  std::vector<const VariableValue *> _val_v_vars;
+  std::vector<Real> _coef;
+};
+#endif
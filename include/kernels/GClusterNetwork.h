@@ -0,0 +1,77 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef GCLUSTERNETWORK_H
+#define GCLUSTERNETWORK_H
+
+#include "Kernel.h"
+#include "GGroup.h"
+#include "GGroupNetwork.h"
+#include <map>
+
+//Forward Declarations
+class GClusterNetwork;
+
+
+template<>
+InputParameters validParams<GClusterNetwork>();
+
+/**
+ * Reaction terms of the grouping method for all mobile and/or immobile
+ * group equations in a single kernel. At each quadrature point the size
+ * distribution is reconstructed once from the coupled group variables and
+ * the residual of every equation is written to its own variable's block,
+ * replacing one GMobile/GImmobileL0/GImmobileL1 per variable.
+ * The off-diagonal blocks hold the exact coupling between group equations.
+ * All group variables must share the FE type of "variable".
+ */
+class GClusterNetwork : public Kernel
+{
+public:
+  GClusterNetwork(const InputParameters & parameters);
+
+  virtual void computeResidual();
+  virtual void computeJacobian();
+  virtual void computeOffDiagJacobian(unsigned int jvar);
+  virtual void residualSetup();
+  virtual void jacobianSetup();
+
+protected:
+  virtual Real computeQpResidual();
+  void reconstructQp();
+  //nonzero network Jacobian entries at every qp of the current element, sorted by column
+  void computeElementJacobian();
+
+  struct JacobianEntry
+  {
+    unsigned int qp;
+    unsigned int row;//GGroupNetwork::index()
+    Real value;//times JxW and coord
+  };
+
+  const GGroup & _gc;
+  GGroupNetwork _network;
+  int _equations;
+  std::vector<unsigned int> _no_vars;//laid out by GGroupNetwork::index()
+  std::vector<const VariableValue *> _val_v_vars;
+  std::vector<const VariableValue *> _val_i_vars;
+  std::vector<Real> _res_qp;
+  std::map<unsigned int, unsigned int> _var_index;//variable number -> GGroupNetwork::index()
+  const Elem * _jac_elem;//element _jac_qp belongs to
+  std::vector<std::vector<JacobianEntry> > _jac_columns;//by GGroupNetwork::index() of the column
+  std::vector<bool> _jac_served;//columns already assembled, by GGroupNetwork::index()
+  std::vector<unsigned int> _row_columns;
+  std::vector<Real> _row_values;
+};
+#endif
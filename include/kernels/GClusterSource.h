@@ -0,0 +1,65 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef GCLUSTERSOURCE_H
+#define GCLUSTERSOURCE_H
+
+#include "Kernel.h"
+#include "GGroup.h"
+#include "GSourceSpectrum.h"
+#include "GDepthProfile.h"
+
+//Forward Declarations
+class GClusterSource;
+class Function;
+
+
+template<>
+InputParameters validParams<GClusterSource>();
+
+/**
+ * Defect production of a whole size spectrum in a single kernel, written to
+ * the L0 (and, above the single size groups, L1) blocks of the groups holding
+ * the source sizes. The rates follow the group scheme of the user object; without
+ * one every source size must be a single size group. The spectrum is switched
+ * by tlimit and the pulse parameters and multiplied by the function and by the
+ * SRIM damage profile at the depth of the quadrature point, if given.
+ */
+class GClusterSource : public Kernel
+{
+public:
+  GClusterSource(const InputParameters & parameters);
+
+  virtual void computeResidual();
+  virtual void computeJacobian() {}
+  virtual void computeOffDiagJacobian(unsigned int) {}
+
+protected:
+  virtual Real computeQpResidual();
+  //rates of the current group scheme, variables with a nonzero one
+  void updateRates();
+
+  const GGroup * _gc;
+  Function * _func;
+  GSourceSpectrum _spectrum;
+  GDepthProfile _profile;//empty: uniform
+  unsigned int _component;//depth coordinate
+  std::vector<Real> _qp_source;//JxW*coord*profile at every qp
+  std::vector<unsigned int> _no_vars;//L0 and L1 of every v group, then of every i group
+  unsigned int _nv;//v type variables
+  int _scheme_id;//of the rates
+  std::vector<unsigned int> _source_vars;
+  std::vector<Real> _source_rates;
+};
+#endif
@@ -15,8 +15,10 @@
 #ifndef GIMMOBILEL1_H
 #define GIMMOBILEL1_H
 
-#include "Kernel.h"
+#include "KernelValue.h"
 #include "GGroup.h"
+#include "GGroupNetwork.h"
+#include <map>
 
 //Forward Declarations
 class GImmobileL1;
@@ -25,18 +27,26 @@ class GImmobileL1;
 template<>
 InputParameters validParams<GImmobileL1>();
 
-class GImmobileL1 : public Kernel
+class GImmobileL1 : public KernelValue
 {
 public:
   
   GImmobileL1(const 
                             InputParameters & parameters);
+
+  virtual void residualSetup();
+  virtual void jacobianSetup();
   
 protected:
-  virtual Real computeQpResidual();
-  virtual Real computeQpJacobian();
+  virtual Real precomputeQpResidual();//reaction sum at _qp, without the test function
+  virtual Real precomputeQpJacobian();//its derivative times _phi[_j][_qp]
+  virtual void computeOffDiagJacobian(unsigned int jvar);
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
+  Real precomputeQpOffDiagJacobian(unsigned int k);//derivative with respect to unknown k of GGroupNetwork::index()
+  void computeElementJacobian();//row of this equation at every qp of the current element
   int getGroupNumber(std::string);
+  int getMomentNumber(std::string);
+  void reconstructQp();
 
 private:
   int _number_v;
@@ -49,5 +59,19 @@ private:
   std::vector<unsigned int> _no_i_vars;
   std::vector<const VariableValue *> _val_i_vars;
   int _cur_size;
+  std::vector<unsigned int> _pos_v;//position of each coupled variable in _coef_v/_coef_i
+  std::vector<unsigned int> _pos_i;
+  std::vector<Real> _coef_v;//coefficients of all groups, zero outside the coupled ones
+  std::vector<Real> _coef_i;
+  GSizeDistribution _dist_v;//c(n) at the current qp from the coupled groups
+  GSizeDistribution _dist_i;
+  GGroupNetwork _network;//terms of this equation
+  unsigned int _eq;
+  std::map<unsigned int, unsigned int> _var_index;//coupled variable number -> GGroupNetwork::index()
+  const Elem * _jac_elem;//element _jac_qp belongs to
+  std::vector<bool> _jac_served;//columns of _jac_qp already assembled, by GGroupNetwork::index()
+  std::vector<std::vector<Real> > _jac_qp;
+  unsigned int _jac_diag_qp;//qp of _jac_diag
+  Real _jac_diag;
 };
 #endif 
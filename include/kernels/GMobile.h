@@ -15,8 +15,10 @@
 #ifndef GMOBILE_H
 #define GMOBILE_H
 
-#include "Kernel.h"
+#include "KernelValue.h"
 #include "GGroup.h"
+#include "GGroupNetwork.h"
+#include <map>
 
 //Forward Declarations
 class GMobile;
@@ -25,19 +27,25 @@ class GMobile;
 template<>
 InputParameters validParams<GMobile>();
 
-class GMobile : public Kernel
+class GMobile : public KernelValue
 {
 public:
   
   GMobile(const 
                             InputParameters & parameters);
+
+  virtual void residualSetup();
+  virtual void jacobianSetup();
   
 protected:
-  virtual Real computeQpResidual();
-  virtual Real computeQpJacobian();
+  virtual Real precomputeQpResidual();//reaction sum at _qp, without the test function
+  virtual Real precomputeQpJacobian();//its derivative times _phi[_j][_qp]
+  virtual void computeOffDiagJacobian(unsigned int jvar);
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
+  Real precomputeQpOffDiagJacobian(unsigned int k);//derivative with respect to unknown k of GGroupNetwork::index()
+  void computeElementJacobian();//row of this equation at every qp of the current element
   int getGroupNumber(std::string);
-  double getConcBySize(int i);
+  void reconstructQp();
 
 private:
   int _number_v;
@@ -50,6 +58,15 @@ private:
   std::vector<unsigned int> _no_i_vars;
   std::vector<const VariableValue *> _val_i_vars;
   int _cur_size;
-  int max_v,max_i;
+  const GSizeDistribution * _dist_v;//c(n) at the current qp, shared through GGroup
+  const GSizeDistribution * _dist_i;
+  GGroupNetwork _network;//terms of this equation
+  unsigned int _eq;
+  std::map<unsigned int, unsigned int> _var_index;//coupled variable number -> GGroupNetwork::index()
+  const Elem * _jac_elem;//element _jac_qp belongs to
+  std::vector<bool> _jac_served;//columns of _jac_qp already assembled, by GGroupNetwork::index()
+  std::vector<std::vector<Real> > _jac_qp;
+  unsigned int _jac_diag_qp;//qp of _jac_diag
+  Real _jac_diag;
 };
 #endif 
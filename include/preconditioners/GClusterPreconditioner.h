@@ -0,0 +1,71 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+
+#ifndef GCLUSTERPRECONDITIONER_H
+#define GCLUSTERPRECONDITIONER_H
+
+#include "MoosePreconditioner.h"
+#include "GBorderedBandLU.h"
+#include "GGroupNetwork.h"
+#include "libmesh/preconditioner.h"
+#include "libmesh/numeric_vector.h"
+
+class GClusterPreconditioner;
+class GGroup;
+class NonlinearSystem;
+
+template<>
+InputParameters validParams<GClusterPreconditioner>();
+
+/**
+ * Preconditioner for the grouped cluster equations, type = GCP in [Preconditioning].
+ * At every point (node, or the scalars of a 0D problem) the block of the group
+ * variables couples each immobile group only to its neighbours in size, and
+ * every group to the L0 of the mobile sizes. The off diagonal entries of the block
+ * are the sparse jacobian rows of GGroupNetwork from the rate tables of GGroup at the
+ * current solution, times the lumped mass of the node; the diagonal is that of the
+ * assembled jacobian, so the time derivative and the diffusion are in it and the
+ * coupling matrix of the problem is not needed. The block is factored by
+ * GBorderedBandLU: banded elimination over the immobile groups, L0 and L1 of a
+ * group side by side, and the mobile L0 as the dense border. Couplings between
+ * points are left to the Krylov solver; other variables get their diagonal.
+ */
+class GClusterPreconditioner : public MoosePreconditioner, public Preconditioner<Number>
+{
+public:
+  GClusterPreconditioner(const InputParameters & params);
+  virtual ~GClusterPreconditioner();
+
+  virtual void init();
+  virtual void setup();
+  virtual void apply(const NumericVector<Number> & x, NumericVector<Number> & y);
+  virtual void clear();
+
+protected:
+  NonlinearSystem & _nl;
+  const GGroup * _gg;
+  GGroupNetwork _network;
+
+  //group dofs at each local point in GGroupNetwork::index() order, and all of them in turn
+  std::vector<std::vector<dof_id_type> > _dofs;
+  std::vector<dof_id_type> _point_dofs;
+  std::vector<dof_id_type> _nodes;//node of each point, empty for the scalars
+  std::vector<GBorderedBandLU> _lu;
+  //local dof -> point, -1 for the other variables
+  std::vector<int> _point;
+  //lumped mass of each point
+  std::vector<Real> _weight;
+  //assembled diagonal, inverted for the other variables
+  UniquePtr<NumericVector<Number> > _diag;
+
+  std::vector<unsigned int> _rows, _cols, _row_columns;
+  std::vector<double> _vals, _row_values, _xp;
+  std::vector<Number> _x;
+};
+
+#endif //GCLUSTERPRECONDITIONER_H
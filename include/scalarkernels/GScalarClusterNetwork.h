@@ -0,0 +1,56 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef GSCALARCLUSTERNETWORK_H
+#define GSCALARCLUSTERNETWORK_H
+
+#include "ScalarKernel.h"
+#include "GGroup.h"
+#include "GGroupNetwork.h"
+
+//Forward Declarations
+class GScalarClusterNetwork;
+
+
+template<>
+InputParameters validParams<GScalarClusterNetwork>();
+
+/**
+ * GClusterNetwork for a spatially homogeneous (0D) problem, where every group
+ * coefficient is a FIRST order SCALAR variable. The residual of every selected
+ * equation and the full coupling Jacobian are written to the scalar blocks.
+ */
+class GScalarClusterNetwork : public ScalarKernel
+{
+public:
+  GScalarClusterNetwork(const InputParameters & parameters);
+
+  virtual void reinit();
+  virtual void computeResidual();
+  virtual void computeJacobian();
+
+protected:
+  void reconstruct();
+
+  const GGroup & _gc;
+  GGroupNetwork _network;
+  int _equations;
+  std::vector<unsigned int> _no_vars;//laid out by GGroupNetwork::index()
+  std::vector<const VariableValue *> _val_vars;
+  std::vector<Real> _u_vars;
+  std::vector<Real> _res;
+  std::vector<Real> _jac;
+};
+#endif
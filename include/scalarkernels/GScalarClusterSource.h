@@ -0,0 +1,56 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef GSCALARCLUSTERSOURCE_H
+#define GSCALARCLUSTERSOURCE_H
+
+#include "ScalarKernel.h"
+#include "GGroup.h"
+#include "GSourceSpectrum.h"
+
+//Forward Declarations
+class GScalarClusterSource;
+class Function;
+
+
+template<>
+InputParameters validParams<GScalarClusterSource>();
+
+/**
+ * GClusterSource for a spatially homogeneous (0D) problem, where every group
+ * coefficient is a FIRST order SCALAR variable.
+ */
+class GScalarClusterSource : public ScalarKernel
+{
+public:
+  GScalarClusterSource(const InputParameters & parameters);
+
+  virtual void reinit();
+  virtual void computeResidual();
+  virtual void computeJacobian();
+
+protected:
+  void updateRates();
+
+  const GGroup * _gc;
+  Function * _func;
+  GSourceSpectrum _spectrum;
+  std::vector<unsigned int> _no_vars;//L0 and L1 of every v group, then of every i group
+  unsigned int _nv;
+  int _scheme_id;
+  std::vector<unsigned int> _source_vars;
+  std::vector<Real> _source_rates;
+};
+#endif
@@ -0,0 +1,42 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef SCALARCONSTANTKERNEL_H
+#define SCALARCONSTANTKERNEL_H
+
+#include "ODEKernel.h"
+
+//Forward Declarations
+class ScalarConstantKernel;
+
+template<>
+InputParameters validParams<ScalarConstantKernel>();
+
+/**
+ * ConstantKernel for a SCALAR variable: -value until tlimit.
+ */
+class ScalarConstantKernel : public ODEKernel
+{
+public:
+  ScalarConstantKernel(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual();
+  virtual Real computeQpJacobian();
+  Real _t_limit;
+  Real _val;
+};
+
+#endif
@@ -17,9 +17,10 @@
 #define BCCIRONPROPERTY_H
 
 #include "GeneralUserObject.h"
-#include "GMaterialConstants.h"
+#include "GPolicyMaterial.h"
+#include "BCCIronRates.h"
 
-class BCCIronProperty : public GMaterialConstants
+class BCCIronProperty : public GPolicyMaterial<BCCIronRates>
 {
 public:
   BCCIronProperty(const InputParameters & parameters);
@@ -29,18 +30,7 @@ public:
   virtual void execute();
   virtual void finalize();
 
-  Real absorb(int,int,std::string,std::string,double,int,int) const;
-  Real emit(int,int,double,std::string,std::string,int,int) const;
-  Real disl_ksq(int,std::string,double,int=1) const;
-  double energy(int,std::string,std::string) const;
-  double D_prefactor(int,std::string) const;
-  double diff(int, std::string,double) const;
   double Ebinding(double,const char*,double=1) const;
-
-private:
-  Real _rho_d;
-  Real _i_bias;
-  Real _v_bias;
 };
 
 template<>
@@ -0,0 +1,154 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+
+#ifndef BCCIRONRATES_H
+#define BCCIRONRATES_H
+
+#include "GRateLaws.h"
+#include <cmath>
+#include <cstdio>
+
+/**
+ * Rate laws of bcc iron, diffusivities of the small clusters from literature
+ */
+class BCCIronRates
+{
+public:
+  BCCIronRates(double v_bias, double i_bias, double rho_d);
+
+  static constexpr double INF = 100;
+  static constexpr double SCALE = 1;//change unit from um
+  static constexpr double PI = 3.14159265359;
+  static constexpr double Vatom = 1.181e-11;//iron atom volume um^3
+  static constexpr double Boltz_const = 8.6173315e-5;//boltzmann constant eV/K
+
+  template<GSpecies S, GEnergyType E> double energy(int) const;//unit:eV
+  template<GSpecies S> double D_prefactor(int) const;
+  template<GSpecies S> double diff(int,double) const;//in um^2/s
+  template<GSpecies A, GSpecies B> double absorb(int,int,double,int,int) const;
+  template<GSpecies A, GSpecies B> double absorbPair(int,int,int,double) const {return 0.0;}//no pair absorption yet, as GMaterialConstants::absorbVV
+  template<GSpecies S> double emit(int,int,double,int,int) const;
+  template<GSpecies S> double disl_ksq(int,double,int=1) const;
+
+private:
+  double _v_bias;
+  double _i_bias;
+  double _rho_d;
+};
+
+inline
+BCCIronRates::BCCIronRates(double v_bias, double i_bias, double rho_d) :
+    _v_bias(v_bias),
+    _i_bias(i_bias),
+    _rho_d(rho_d)
+{
+}
+
+template<GSpecies S, GEnergyType E>
+inline double
+BCCIronRates::energy(int s) const
+{
+  if(S == G_V && E == G_MIGRATION){
+    switch(s){
+      case 1: return 0.83;
+      case 2: return 0.62;
+      case 3: return 0.35;
+      case 4: return 0.48;
+      default: return INF;
+    }
+  }
+  if(S == G_I && E == G_MIGRATION){
+    switch(s){
+      case 1: return 0.34;
+      case 2: return 0.42;
+      case 3: return 0.43;
+      default: return INF;
+    }
+  }
+  if (s==1) {
+    printf("called: error\n");//size should be larger than 1 to have a binding energy
+    return 0.0;
+  }
+  if(S == G_V){
+    switch(s){
+      case 2: return 0.30;
+      case 3: return 0.37;
+      case 4: return 0.62;
+      default: return 2.2 - 3.2346 * (std::pow(s,2.0/3)-std::pow(s-1,2.0/3));
+    }
+  }
+  switch(s){
+    case 2: return 0.80;
+    case 3: return 0.92;
+    case 4: return 1.64;
+    default: return 3.8 - 5.06*(std::pow(s,2.0/3)-std::pow(s-1,2.0/3));
+  }
+}
+
+template<GSpecies S>
+inline double
+BCCIronRates::D_prefactor(int s) const
+{
+  double D0 = 0.0;//m^2/s
+  if(S == G_V){
+    switch(s){
+      case 1: D0 = 7.9e-7; break;
+      case 2: D0 = 3.5e-8; break;
+      default: D0 = 0.0;
+    }
+  }
+  else{
+    switch(s){
+      case 1: D0 = 1.3e-8; break;
+      case 2: D0 = 351.6e-8; break;//this number is a little weird
+      case 3: D0 = 12.1e-8; break;
+      case 4: D0 = 12.3e-8; break;
+      default: D0 = 9.0e-7*std::pow(s,-0.6);
+    }
+  }
+  return D0*1.0e12*SCALE*SCALE;//change m^2/s to um^2/s
+}
+
+template<GSpecies S>
+inline double
+BCCIronRates::diff(int S1, double T) const
+{
+  return D_prefactor<S>(S1)*std::exp(-energy<S,G_MIGRATION>(S1)/Boltz_const/T);
+}
+
+//tag1, tag2 denotes the mobility of the two partners; 1: mobile, 0: immobile
+template<GSpecies A, GSpecies B>
+inline double
+BCCIronRates::absorb(int S1, int S2, double T, int tag1, int tag2) const
+{
+  if(tag1==0 && tag2==0) return 0.0;
+  double r_vi = 0.65e-3*SCALE;//um
+  double r1 = std::pow(S1*Vatom*3/4/PI,1.0/3); //cluster effective radius
+  double r2 = std::pow(S2*Vatom*3/4/PI,1.0/3); //cluster effective radius
+  return 4*PI*(diff<A>(S1,T)*tag1+diff<B>(S2,T)*tag2)*(r1+r2+r_vi);
+}
+
+//for now only consider self species emmision, S1 emits S2, S1==1
+template<GSpecies S>
+inline double
+BCCIronRates::emit(int S1, int S2, double T, int tag1, int tag2) const
+{
+  if(S1 > S2 && S2==1)
+    return absorb<S,S>(S1,S2,T,tag1,tag2)/(Vatom* std::pow(SCALE,3)) *std::exp(-energy<S,G_BINDING>(S1)/Boltz_const/T);//unit:/s
+  return 0.0;
+}
+
+template<GSpecies S>
+inline double
+BCCIronRates::disl_ksq(int S1, double T, int tag) const
+{
+  double bias = (S == G_V)? _v_bias : _i_bias;
+  return tag * diff<S>(S1,T) * _rho_d * bias;
+}
+
+#endif //BCCIRONRATES_H
@@ -0,0 +1,72 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+
+#ifndef GDEPTHPROFILE_H
+#define GDEPTHPROFILE_H
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+/**
+ * Depth profile of a SRIM output table (vacancy.csv, range.csv: depth in Angstrom,
+ * then one or more columns, e.g. the vacancies by ions and by recoils, summed),
+ * read once and evaluated as a piecewise linear interpolant: constant before the
+ * first depth, zero past the last one. The rows past the last nonzero value are
+ * dropped, so the last depth is that of the damaged layer. The SRIM depths are equally spaced, so
+ * value() finds the interval by one division; other tables are binary searched.
+ * Errors throw std::runtime_error.
+ */
+class GDepthProfile
+{
+public:
+  enum Normalization
+  {
+    NONE = 0,
+    MEAN = 1,//average 1 from the surface to the last nonzero depth
+    PEAK = 2//largest value 1
+  };
+
+  GDepthProfile();
+
+  //depths are multiplied by depth_unit, e.g. 1e-4 for Angstrom to um
+  void read(const std::string & file, double depth_unit);
+  void normalize(Normalization normalization, double factor);
+
+  bool empty() const {return _x.empty();}
+  double depth() const {return _x.empty()? 0.0 : _x.back();}
+  inline double value(double x) const;
+
+protected:
+  std::vector<double> _x;
+  std::vector<double> _y;
+  bool _uniform;
+  double _dx_inv;
+};
+
+double
+GDepthProfile::value(double x) const
+{
+  unsigned int n = _x.size();
+  if(n == 0) return 1.0;
+  if(x <= _x[0]) return _y[0];
+  if(x > _x[n-1]) return 0.0;
+  if(n == 1) return _y[0];
+  unsigned int k;
+  if(_uniform){
+    k = std::min((unsigned int)((x-_x[0])*_dx_inv),n-2);
+    if(x < _x[k] && k > 0) k--;//roundoff at a node
+    else if(x > _x[k+1] && k < n-2) k++;
+  }
+  else
+    k = std::upper_bound(_x.begin(),_x.end(),x)-_x.begin()-1;
+  if(k >= n-1) return _y[n-1];
+  return _y[k]+(_y[k+1]-_y[k])*(x-_x[k])/(_x[k+1]-_x[k]);
+}
+
+#endif //GDEPTHPROFILE_H
@@ -0,0 +1,62 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+
+#ifndef GGAINCONVOLUTION_H
+#define GGAINCONVOLUTION_H
+
+#include <complex>
+#include <vector>
+
+/**
+ * Coagulation gain of the mobile sizes of one species,
+ *   gain(n) = sum_{a+b=n, a>=b} c(a)*c(b)*K(a,b),  n = 1..M,
+ * with K the absorption rates among the M mobile sizes. The sum is a discrete
+ * convolution: if K factors into a few terms u_r(a)*v_r(b) (every entry up to a
+ * relative tolerance) it is evaluated with FFTs in O(R*M*log M), otherwise by a tiled
+ * direct sum in O(M^2/4). The kernel is analysed once per rate table; gain()
+ * is const and takes its buffers from the caller, so threads can share it.
+ */
+class GGainConvolution
+{
+public:
+  enum Method
+  {
+    DIRECT = 0,//tiled direct sum
+    FFT = 1//low rank kernel with FFT convolutions
+  };
+
+  GGainConvolution();
+
+  //K(a,b) = kernel[(a-1)*M+b-1], a,b = 1..M; fft: allow the FFT evaluation when the
+  //kernel has a low rank approximation within tol*|K(a,b)| that is cheaper than the direct sum
+  void setKernel(const std::vector<double> & kernel, int M, bool fft, double tol);
+
+  //gain(n) for n = 1..M from c(1..M), both indexed by size (index 0 unused)
+  void gain(const double * c, std::vector<double> & gain, std::vector<std::complex<double> > & work) const;
+
+  int size() const {return _M;}
+  Method method() const {return _method;}
+  unsigned int rank() const {return _u.size();}
+
+protected:
+  //low rank approximation by adaptive cross approximation with full pivoting, false if it
+  //needs more than max_rank terms
+  bool factor(const std::vector<double> & kernel, double tol, unsigned int max_rank);
+  void transform(std::complex<double> * x, bool inverse) const;
+
+  int _M;
+  Method _method;
+  std::vector<double> _kernel;//row major, direct sum and the diagonal correction
+  std::vector<std::vector<double> > _u;//K(a,b) ~ sum_r _u[r][a-1]*_v[r][b-1]
+  std::vector<std::vector<double> > _v;
+  unsigned int _length;//FFT length, a power of two >= 2M+1
+  std::vector<std::complex<double> > _twiddle;
+  std::vector<unsigned int> _reverse;//bit reversal permutation
+};
+
+#endif //GGAINCONVOLUTION_H
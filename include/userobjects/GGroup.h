@@ -10,8 +10,11 @@
 #define GGROUP_H
 
 #include "GMaterialConstants.h"
+#include "GGroupScheme.h"
 #include "Function.h"
 #include "GeneralUserObject.h"
+#include <list>
+#include <map>
 
 class GGroup;
 class Function;
@@ -21,60 +24,79 @@ template<>
 InputParameters validParams<GGroup>();
 
 /**
- * Saturation of a phase as a function of
- * effective saturation of that phase,
- * and its derivatives wrt effective saturation
+ * Group scheme and rate tables of the grouping method as a user object,
+ * the scheme itself lives in GGroupScheme; this adds the material, the
+ * temperature dependence of the tables and the MOOSE variable interface.
  */
-class GGroup : public GeneralUserObject
+class GGroup : public GeneralUserObject, public GGroupScheme
 {
 public:
   GGroup(const InputParameters & parameters);
   ~GGroup();
 
+  void initialSetup();
   void initialize();
   void execute();
   void finalize();
 
-  void setGroupScheme();
   void updateGroupScheme();
-  int CurrentGroupV(int) const;
-  int CurrentGroupI(int) const;
+  void updateActiveGroups();
+  void updateSignificantSizes();
+  //with active_range, the groups up to max_source_v/max_source_i and active_buffer groups above
+  //them react from the start, as in Geminio0D; the Sources actions check that the sizes are covered
+  bool coversSourceSizes(int max_v, int max_i) const;
+  //update = true: the group boundaries move during the run
+  bool updatesScheme() const {return _update;}
 
-  Real _emit(int) const;//return kth group constant based on single shape function
-  Real _disl(int) const;//return dislocation sink strenght based on shape function
-  Real _diff(int) const;//return diffusion coefficient based on shape function
-  Real _absorb(int,int) const;//return kth,jth group constant based on double shape functions
+  using GGroupScheme::sizeDistribution;
+  const GSizeDistribution & sizeDistribution(GSpecies, const std::vector<const VariableValue *> &, unsigned int, THREAD_ID) const;
 
-  std::vector<int> GroupScheme_v;
-  std::vector<int> GroupScheme_i;
-  Real* GroupScheme_v_sq;//dispersion
-  Real* GroupScheme_i_sq;//dispersion
-  Real* GroupScheme_v_avg;//group avg
-  Real* GroupScheme_i_avg;//group avg
-  int* GroupScheme_v_del;//group del
-  int* GroupScheme_i_del;//group del
-  Real _atomic_vol;
+  void buildRateTables(GRateTable &, Real) const;
+  void updateRates(Real);//snapshot the tables at a new temperature
+  Real currentTemperature() const {return _T_current;}
 
 
+  //dofs of L0 and L1 of every v group, then of every i group (GGroupNetwork::index()), at each
+  //point owned here: the nodes, or the scalar variables of a 0D problem; with nodes also the node
+  //of each point, left empty for the scalars
+  void groupDofs(std::vector<std::vector<dof_id_type> > &, std::vector<dof_id_type> * nodes = NULL) const;
+
 protected:
-  MooseEnum _GroupScheme;
-  Real _dr_coef;
-  int _Ng_v;
-  int _Ng_i;
-  int _num_v;
-  int _num_i;
-  int _v_size;
-  int _i_size;
-  int _single_v_group;
-  int _single_i_group;
+  virtual void schemeError(const std::string &) const;
+
   Real _T;
   Function * const _T_func;
   bool _update;
+  Real _update_threshold;
+  std::string _group_variables;//GVariable block name, variables <name><0|1><v|i><group>
+  std::vector<int> & _restart_v;//adapted boundaries for restart/recover, empty for the static scheme
+  std::vector<int> & _restart_i;
+  bool _active_range;
+  Real _active_threshold;
+  int _active_buffer;
+  int _max_source_v;//largest source sizes, 0 if none
+  int _max_source_i;
+  Real _skip_tolerance;
 //  Real* _emit_array;//total _Ng_v + _Ng_i
 //  Real** _absorb__matrix;//(_Ng_v+_Ng_i)xtotal_no_of_mobile_species
   bool _has_material;
   const GMaterialConstants * const _material;
   Point dummy;
+
+  //largest |c(n)| over all points of the current solution, by size (index 0 unused)
+  void sizeMonitor(const std::vector<std::vector<dof_id_type> > &, std::vector<Real> &, std::vector<Real> &);
+
+  const GRateTable & cachedRateTable(Real);
+  void interpolateRateTables(const GRateTable &, const GRateTable &, Real, GRateTable &) const;
+
+  std::vector<Real> _T_grid;//optional temperatures to interpolate tables between
+  unsigned int _cache_size;
+  std::map<Real,GRateTable> _rate_cache;//tables at previously seen temperatures
+  std::list<Real> _cache_order;//insertion order, oldest evicted first
+  Real _T_current;//temperature of the current snapshot, <0 before the first one
+
+  mutable std::vector<std::vector<Real> > _coef_v;//per thread gather buffers
+  mutable std::vector<std::vector<Real> > _coef_i;
 };
 
 #endif // 
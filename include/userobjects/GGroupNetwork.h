@@ -0,0 +1,371 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+
+#ifndef GGROUPNETWORK_H
+#define GGROUPNETWORK_H
+
+#include "GGroupScheme.h"
+#include <algorithm>
+
+/**
+ * Reaction network of the grouping method for all group equations at once.
+ * The unknowns are the group coefficients, laid out as the coupled_v_vars and
+ * coupled_i_vars lists built by AddGMobile: moment m (0: L0, 1: L1) of v group g
+ * at 2*(g-1)+m, followed by the i groups. The size distribution
+ * c(n) = L0 + L1*(n-avg) is taken from GGroupScheme::sizeDistribution() and every reaction
+ * term of GMobile, GImmobileL0 and GImmobileL1 is handed to a sink as
+ * coef*c(a) or coef*c(a)*c(b), so residuals and Jacobian entries come from the
+ * same term list. It only depends on GGroupScheme, so it is shared by the
+ * kernels and the standalone 0D integrator. Groups above GGroupScheme::activeGroups()
+ * are held at zero: their equations are not selected and their sizes skipped. The loss terms
+ * of the mobile groups skip the partners outside GGroupScheme::significantRuns().
+ * For the Jacobian the terms of an equation are compiled once per group scheme and rate
+ * table: the linear ones (emission, dislocation sinks) into a constant sparse row, the
+ * absorption pairs into a list with their unknowns looked up, so a Newton step only
+ * adds the pair derivatives at the current c(n) to the constant part.
+ */
+class GGroupNetwork
+{
+public:
+  GGroupNetwork(const GGroupScheme & gc, int max_mobile_v, int max_mobile_i, unsigned int tid = 0);
+
+  //equation sets, GMobile equations and GImmobileL0/L1 equations
+  enum { MOBILE = 1, IMMOBILE = 2 };
+
+  unsigned int size() const {return 2*(_Ng_v+_Ng_i);}
+  //'+': vacancy; '-': intersitial group
+  unsigned int index(int group, int moment) const {return (group>0)? 2*(group-1)+moment : 2*(_Ng_v-group-1)+moment;}
+
+  //reconstruct c(n) from the group coefficients laid out by index()
+  void reconstruct(const std::vector<double> & u);
+  //or use size distributions already reconstructed by GGroupScheme::sizeDistribution()
+  void setDistributions(const GSizeDistribution & dist_v, const GSizeDistribution & dist_i);
+  double conc(int n) const {return (n>0)? _dist_v->conc(n) : _dist_i->conc(-n);}
+  //group of a cluster size and d c(n)/d L1 of that group, '+': vacancy; '-': intersitial
+  int group(int n) const {return (n>0)? _dist_v->group(n) : -_dist_i->group(-n);}
+  double offset(int n) const {return (n>0)? _dist_v->offset(n) : _dist_i->offset(-n);}
+  //coefficient Lm of group g
+  double moment(int g, int m) const {return (g>0)? _dist_v->coefficients()[2*(g-1)+m] : _dist_i->coefficients()[2*(-g-1)+m];}
+
+  //residual (loss minus gain) of the selected equations, others are left untouched
+  void residual(std::vector<double> & res, int equations) const;
+  //residual of equation eq alone, the value of GMobile, GImmobileL0 and GImmobileL1
+  double residual(unsigned int eq) const;
+  //derivative of each selected residual with respect to its own unknown
+  void diagJacobian(std::vector<double> & jac, int equations) const;
+  //the same for equation eq alone
+  double diagJacobian(unsigned int eq) const;
+  //derivative of each selected residual with respect to every unknown, row eq starts at eq*size()
+  void jacobian(std::vector<double> & jac, int equations) const;
+  //derivative of residual eq with respect to every unknown
+  void jacobianRow(std::vector<double> & row, unsigned int eq) const;
+  //add the derivatives of residual eq to row[0..size()-1]
+  void addJacobianRow(double * row, unsigned int eq) const;
+  //nonzero derivatives of residual eq, each column once, without a dense row
+  void sparseJacobianRow(unsigned int eq, std::vector<unsigned int> & columns, std::vector<double> & values) const;
+
+  /**
+   * Hand every term of the selected equations to a sink providing
+   *   void add(unsigned int eq, double coef, int a);        // coef*c(a)
+   *   void add(unsigned int eq, double coef, int a, int b); // coef*c(a)*c(b)
+   *   void addMoment(unsigned int eq, double coef, int g, int m);        // coef*Lm(g)
+   *   void addMoment(unsigned int eq, double coef, int g, int m, int b); // coef*Lm(g)*c(b)
+   * with Lm(g) moment m of group g, for sums over all sizes of a group.
+   * The terms are unscaled, equation eq is multiplied by scale(eq) afterwards.
+   * With lumped the mobile equations leave out c(n)*sum_j c(j)*absorb(n,j) and the
+   * coagulation gain, which residual() and diagJacobian() take from
+   * GGroupScheme::mobileLoss() and mobileGain().
+   */
+  template<class Sink> void evaluate(Sink & sink, int equations, bool lumped = false) const;
+  //the same for equation eq only
+  template<class Sink> void equationTerms(Sink & sink, unsigned int eq, bool lumped = false) const;
+  double scale(unsigned int eq) const {return _scale[eq];}
+  //eq is in the selected set and its group is active
+  bool isSelected(unsigned int eq, int equations) const;
+  //signed groups the immobile equations of group g react with: the single size groups of both species,
+  //the groups of the own species below g that grow into it by absorbing a mobile cluster of that species,
+  //and those above g that shrink into it by absorbing one of the other species or by emission
+  static void immobileCoupling(int g, int max_mobile_v, int max_mobile_i, int Ng_v, int Ng_i, std::vector<int> & groups);
+
+protected:
+  //GGroupScheme::mobileLoss() and mobileGain() cover every mobile group
+  bool lumpedSums(int equations) const;
+  //signed group (see index()) of equation eq, and whether it is the L0 of a mobile group
+  int equationGroup(unsigned int eq) const {return (eq < (unsigned int)(2*_Ng_v))? eq/2+1 : -(int)((eq-2*_Ng_v)/2+1);}
+  bool isMobile(unsigned int eq) const;
+  //the lumped mobile loss and gain of single size group g and its derivative
+  double lumpedResidual(int g) const;
+  double lumpedDiagJacobian(int g) const;
+
+  //coef*c(a)*c(b) of an equation, or coef*Lm(g)*c(b) with g != 0; unknowns and offsets of
+  //c(a) = L0 + L1*offset(a) and c(b), a0 = a1 = index(g,m) with oa = 0 for a moment
+  struct JacobianPair
+  {
+    double coef;
+    int a, b, g, m;
+    unsigned int a0, a1, b0, b1;
+    double oa, ob;
+  };
+  //terms of one equation, scaled: the constant derivatives by column and the pairs
+  struct CompiledRow
+  {
+    CompiledRow() : scheme_id(-1), rates_id(-1) {}
+    int scheme_id;//GGroupScheme::schemeId() and ratesId() compiled for
+    int rates_id;
+    std::vector<unsigned int> columns;
+    std::vector<double> values;
+    std::vector<JacobianPair> pairs;
+  };
+  struct CompileSink;
+  //terms of equation eq, compiled again after a change of the scheme or the rates
+  const CompiledRow & compiledRow(unsigned int eq) const;
+  //accumulate value in column col of the row sparseJacobianRow() builds
+  void addSparseEntry(std::vector<unsigned int> & columns, unsigned int col, double value) const;
+
+  template<class Sink> void mobileTerms(Sink &, int, bool lumped = false) const;
+  template<class Sink> void immobileL0Terms(Sink &, int) const;
+  template<class Sink> void immobileL1Terms(Sink &, int) const;
+
+  const GGroupScheme & _gc;
+  int _max_mobile_v;
+  int _max_mobile_i;
+  int _Ng_v;
+  int _Ng_i;
+  unsigned int _tid;
+  std::vector<double> _coef_v;
+  std::vector<double> _coef_i;
+  const GSizeDistribution * _dist_v;
+  const GSizeDistribution * _dist_i;
+  std::vector<double> _scale;
+  int _scale_id;//GGroupScheme::schemeId() of _scale
+  mutable std::vector<CompiledRow> _compiled;//by equation
+  mutable std::vector<double> _work;
+  mutable std::vector<double> _sparse_row;//zero outside sparseJacobianRow()
+  mutable std::vector<bool> _sparse_used;
+};
+
+template<class Sink>
+void
+GGroupNetwork::evaluate(Sink & sink, int equations, bool lumped) const
+{
+  if(equations & MOBILE){
+    for(int g=1;g<=_max_mobile_v;g++)
+      mobileTerms(sink,g,lumped);
+    for(int g=1;g<=_max_mobile_i;g++)
+      mobileTerms(sink,-g,lumped);
+  }
+  if(equations & IMMOBILE){
+    for(int g=_max_mobile_v+1;g<=_gc.activeGroups(G_V);g++){
+      immobileL0Terms(sink,g);
+      immobileL1Terms(sink,g);
+    }
+    for(int g=_max_mobile_i+1;g<=_gc.activeGroups(G_I);g++){
+      immobileL0Terms(sink,-g);
+      immobileL1Terms(sink,-g);
+    }
+  }
+}
+
+template<class Sink>
+void
+GGroupNetwork::equationTerms(Sink & sink, unsigned int eq, bool lumped) const
+{
+  bool vtype = eq < (unsigned int)(2*_Ng_v);
+  int g = (vtype? eq : eq-2*_Ng_v)/2+1;
+  int moment = eq%2;
+  if(g <= (vtype? _max_mobile_v : _max_mobile_i)){
+    if(moment==0) mobileTerms(sink,vtype? g:-g,lumped);
+  }
+  else if(moment==0)
+    immobileL0Terms(sink,vtype? g:-g);
+  else
+    immobileL1Terms(sink,vtype? g:-g);
+}
+
+//terms of GMobile::computeQpResidual for the single size group g, s=+1: v, s=-1: i
+template<class Sink>
+void
+GGroupNetwork::mobileTerms(Sink & sink, int g, bool lumped) const
+{
+  int s = (g>0)? 1:-1;
+  int cur_size = s*g;
+  unsigned int eq = index(g,0);
+  int max_v = (_gc.GroupScheme_v.size()>0?_gc.GroupScheme_v.back():0);
+  int max_i = (_gc.GroupScheme_i.size()>0?_gc.GroupScheme_i.back():0);
+  int max_own = (s>0)? max_v : max_i;
+  int active_own = (s>0)? _dist_v->activeSize() : _dist_i->activeSize();//c(n) = 0 above
+  int active_other = (s>0)? _dist_i->activeSize() : _dist_v->activeSize();
+  int mobile_own = (s>0)? _max_mobile_v : _max_mobile_i;
+  int mobile_other = (s>0)? _max_mobile_i : _max_mobile_v;
+  int max_vi = std::min(std::min(cur_size+mobile_other,max_own),active_own);
+
+  if(!lumped){
+    //vi reaction loss(-), over the partners taking part
+    const GGroupScheme::SizeRuns & runs_other = _gc.significantRuns((s>0)? G_I : G_V);
+    for(unsigned int r=0;r<runs_other.size() && runs_other[r].first<=active_other;r++)
+      for(int i=runs_other[r].first;i<=std::min(runs_other[r].second,active_other);i++)
+        sink.add(eq,_gc._absorb(s*cur_size,-s*i),-s*i,s*cur_size);
+
+    //vv reaction loss(-)
+    int last_own = std::min(max_own-cur_size,active_own);
+    const GGroupScheme::SizeRuns & runs_own = _gc.significantRuns((s>0)? G_V : G_I);
+    for(unsigned int r=0;r<runs_own.size() && runs_own[r].first<=last_own;r++)
+      for(int i=runs_own[r].first;i<=std::min(runs_own[r].second,last_own);i++)
+        sink.add(eq,_gc._absorb(s*cur_size,s*i),s*i,s*cur_size);
+  }
+  if(cur_size*2 <= max_own)
+    sink.add(eq,_gc._absorb(s*cur_size,s*cur_size),s*cur_size,s*cur_size);
+
+  //vv reaction gain(+)
+  if(!lumped)
+    for(int i=1;i<=cur_size/2;i++)
+      sink.add(eq,-_gc._absorb(s*(cur_size-i),s*i),s*(cur_size-i),s*i);
+
+  //vi reaction gain(+)
+  for(int i=cur_size+1;i<=max_vi;i++)
+    if(i-cur_size <= mobile_other || i <= mobile_own)//make sure one is mobile
+      sink.add(eq,-_gc._absorb(s*i,s*(cur_size-i)),s*(cur_size-i),s*i);
+
+  //emission loss(-)
+  if(cur_size!=1)
+    sink.add(eq,_gc._emit(s*cur_size),s*cur_size);
+
+  //emission gain(+)
+  if(cur_size<max_own)
+    sink.add(eq,-_gc._emit(s*(cur_size+1)),s*(cur_size+1));
+  if(cur_size==1)
+    for(int i=2;i<=active_own;i++)
+      sink.add(eq,-_gc._emit(s*i),s*i);
+
+  //dislocation loss(-)
+  sink.add(eq,_gc._disl(s*cur_size),s*cur_size);
+}
+
+//terms of GImmobileL0::computeQpResidual for group g, s=+1: v, s=-1: i
+template<class Sink>
+void
+GGroupNetwork::immobileL0Terms(Sink & sink, int g) const
+{
+  int s = (g>0)? 1:-1;
+  int cur_size = s*g;
+  unsigned int eq = index(g,0);
+  const std::vector<int> & scheme = (s>0)? _gc.GroupScheme_v : _gc.GroupScheme_i;
+  const int * del = (s>0)? _gc.GroupScheme_v_del : _gc.GroupScheme_i_del;
+  int mobile_own = (s>0)? _max_mobile_v : _max_mobile_i;
+  int mobile_other = (s>0)? _max_mobile_i : _max_mobile_v;
+  int left = scheme[cur_size-1];
+
+  //left boundary x_{i-1}+1, absorb the same species
+  for(int i=0;i<=mobile_own-1;i++){
+    int tmp_size = std::min(mobile_own-1-i,del[cur_size-1]-1);
+    tmp_size = std::min(tmp_size,left-1-2*i);//prevent duplicating pair from mobile ones.
+    for(int j=0;j<=tmp_size;j++)
+      sink.add(eq,-_gc._absorb(s*(left-i),s*(i+j+1)),s*(left-i),s*(i+j+1));//vv (gain)
+  }
+
+  //left boundary x_{i-1}+1, emission
+  sink.add(eq,_gc._emit(s*(left+1)),s*(left+1));//v emit (loss)
+
+  //left boundary x_{i-1}+1, absorb the opposite species
+  for(int i=0;i<=mobile_other-1;i++){
+    int tmp_size = std::min(mobile_other-1-i,del[cur_size-1]-1);
+    for(int j=0;j<=tmp_size;j++)
+      sink.add(eq,_gc._absorb(s*(left+j+1),-s*(i+j+1)),s*(left+j+1),-s*(i+j+1));//vi (loss)
+  }
+
+  if(cur_size != (int)(scheme.size()-1)){
+    int right = scheme[cur_size];
+
+    //right boundary x_{i}+1, absorb the same species
+    int tmp_size = std::min(mobile_own-1,del[cur_size-1]-1);
+    for(int i=0;i<=tmp_size;i++)
+      for(int j=0;j<=mobile_own-1-i;j++)
+        sink.add(eq,_gc._absorb(s*(right-i),s*(i+j+1)),s*(right-i),s*(i+j+1));//vv (loss)
+
+    //right boundary x_{i}+1, absorb the opposite species
+    tmp_size = std::min(mobile_other-1,del[cur_size-1]-1);
+    for(int i=0;i<=tmp_size;i++){
+      int tmp2 = std::min(mobile_other-1-i,scheme.back()-right-1);
+      for(int j=0;j<=tmp2;j++)
+        sink.add(eq,-_gc._absorb(s*(right+j+1),-s*(i+j+1)),s*(right+j+1),-s*(i+j+1));//vi (gain)
+    }
+
+    //right boundary x_{i}+1, emission
+    sink.add(eq,-_gc._emit(s*(right+1)),s*(right+1));//v emit (gain)
+  }
+}
+
+//terms of GImmobileL1::computeQpResidual for group g, s=+1: v, s=-1: i
+template<class Sink>
+void
+GGroupNetwork::immobileL1Terms(Sink & sink, int g) const
+{
+  int s = (g>0)? 1:-1;
+  int cur_size = s*g;
+  unsigned int eq = index(g,1);
+  const std::vector<int> & scheme = (s>0)? _gc.GroupScheme_v : _gc.GroupScheme_i;
+  const int * del = (s>0)? _gc.GroupScheme_v_del : _gc.GroupScheme_i_del;
+  const double * sq = (s>0)? _gc.GroupScheme_v_sq : _gc.GroupScheme_i_sq;
+  int mobile_own = (s>0)? _max_mobile_v : _max_mobile_i;
+  int mobile_other = (s>0)? _max_mobile_i : _max_mobile_v;
+  int left = scheme[cur_size-1];
+  int right = scheme[cur_size];
+  if(sq[cur_size-1]< 1.0e-12) return;
+
+  double coefi_1 = (-1-del[cur_size-1])/2.0;
+  double coefi = (-1+del[cur_size-1])/2.0;
+
+  //left boundary x_{i-1}+1, absorb the same species
+  for(int i=0;i<=mobile_own-1;i++){
+    int tmp_size = std::min(mobile_own-1-i,del[cur_size-1]-1);
+    for(int j=0;j<=tmp_size;j++)
+      sink.add(eq,-(coefi_1+j+1)*_gc._absorb(s*(left-i),s*(i+j+1)),s*(left-i),s*(i+j+1));//vv (gain)
+  }
+
+  //left boundary x_{i-1}+1, emission
+  sink.add(eq,(coefi_1+1)*_gc._emit(s*(left+1)),s*(left+1));//v emit (loss)
+
+  //left boundary x_{i-1}+1, absorb the opposite species
+  for(int i=0;i<=mobile_other-1;i++){
+    int tmp_size = std::min(mobile_other-1-i,del[cur_size-1]-1);
+    for(int j=0;j<=tmp_size;j++)
+      sink.add(eq,(coefi_1+j+1)*_gc._absorb(s*(left+j+1),-s*(i+j+1)),s*(left+j+1),-s*(i+j+1));//vi (loss)
+  }
+
+  if(cur_size != (int)(scheme.size()-1)){
+
+    //right boundary x_{i}+1, absorb the same species
+    int tmp_size = std::min(mobile_own-1,del[cur_size-1]-1);
+    for(int i=0;i<=tmp_size;i++)
+      for(int j=0;j<=mobile_own-1-i;j++)
+        sink.add(eq,(coefi-i)*_gc._absorb(s*(right-i),s*(i+j+1)),s*(right-i),s*(i+j+1));//vv (loss)
+
+    //right boundary x_{i}+1, absorb the opposite species
+    tmp_size = std::min(mobile_other-1,del[cur_size-1]-1);
+    for(int i=0;i<=tmp_size;i++){
+      int tmp2 = std::min(mobile_other-1-i,scheme.back()-right-1);
+      for(int j=0;j<=tmp2;j++)
+        sink.add(eq,-(coefi-i)*_gc._absorb(s*(right+j+1),-s*(i+j+1)),s*(right+j+1),-s*(i+j+1));//vi (gain)
+    }
+
+    //right boundary x_{i}+1, emission
+    sink.add(eq,-coefi*_gc._emit(s*(right+1)),s*(right+1));//v emit (gain)
+  }
+
+  //inside interval, summed over k in the group moments of the rates
+  for(int m=0;m<=1;m++){
+    for(int j=1;j<=std::min(mobile_own,del[cur_size-1]-1);j++)
+      sink.addMoment(eq,-_gc.absorbMoment(g,m,s*j)*j,g,m,s*j);//vv
+    for(int j=1;j<=std::min(mobile_other,del[cur_size-1]-1);j++)
+      sink.addMoment(eq,-_gc.absorbMoment(g,m,-s*j)*(-j),g,m,-s*j);//vi
+    sink.addMoment(eq,_gc.emitMoment(g,m),g,m);//need make up for the beginning point
+  }
+  sink.add(eq,-_gc._emit(s*(left+1)),s*(left+1));//makeup
+}
+
+#endif //GGROUPNETWORK_H
@@ -0,0 +1,297 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+
+#ifndef GGROUPSCHEME_H
+#define GGROUPSCHEME_H
+
+#include "GGainConvolution.h"
+#include "GRateLaws.h"
+#include "GSizeDistribution.h"
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Group scheme and rate tables of the grouping method without any MOOSE
+ * dependence, so the reaction network can also be built outside the app
+ * (see standalone/). GGroup adds the input parameters, temperature
+ * handling and rate caching on top of it.
+ */
+class GGroupScheme
+{
+public:
+  enum SchemeType
+  {
+    UNIFORM = 0,
+    RSPACE = 1
+  };
+
+  GGroupScheme(SchemeType scheme, double dr_coef, int Ng_v, int Ng_i, int num_v, int num_i,
+               int v_size, int i_size, int single_v_group, int single_i_group, unsigned int n_threads = 1);
+  virtual ~GGroupScheme();
+
+  void setGroupScheme();
+  //replace the boundaries x_0..x_Ng, with the same number of groups and largest sizes as before
+  //so the rate tables stay valid; the tables built on the groups are rebuilt
+  void setGroupScheme(const std::vector<int> & scheme_v, const std::vector<int> & scheme_i);
+  //boundaries of a species adapted to c(n) (by size, index 0 unused): the single size groups are
+  //kept, the others gather where c changes steeply and widen over flat or empty tails
+  void adaptedScheme(GSpecies, const std::vector<double> & c, std::vector<int> & scheme) const;
+  //switch to the adapted scheme of both species once a group holds more than 1+threshold times
+  //its share of the weight; the previous boundaries are returned for remapCoefficients()
+  bool adaptGroupScheme(const std::vector<double> & c_v, const std::vector<double> & c_i, double threshold,
+                        std::vector<int> & old_v, std::vector<int> & old_i);
+  //group coefficients of the old scheme projected onto the current one, conserving
+  //sum_n c(n) and sum_n n*c(n) of every group
+  void remapCoefficients(GSpecies, const std::vector<int> & old_scheme, const std::vector<double> & old_coef,
+                         std::vector<double> & coef) const;
+  //groups 1..activeGroups() take part in the reactions, the others are held at zero; all groups
+  //unless set, kept at the same largest size by a new scheme
+  int activeGroups(GSpecies species) const {return (species == G_V)? _active_v : _active_i;}
+  void setActiveGroups(int active_v, int active_i);
+  //add the production of value clusters of size n = 1..maxSizeV()/maxSizeI() per unit time to the rates
+  //of the group coefficients of its species (L0, L1 of each group in turn), in the scaling of the
+  //group equations: value/del to L0 and value*(n-avg)/(del*sq) to L1 of the group holding n
+  void addSource(GSpecies, int n, double value, std::vector<double> & rate) const;
+  //largest |L0|*del of every group (by group, index 0 unused) over the coefficient sets passed in turn
+  void groupContent(GSpecies, const std::vector<double> & coef, std::vector<double> & content) const;
+  //extend the active groups so that the last one holding more than threshold times the largest
+  //content, or any content above the active groups, is followed by buffer active groups, growing
+  //by at least an eighth; they never shrink. True if extended
+  bool extendActiveGroups(const std::vector<double> & content_v, const std::vector<double> & content_i,
+                          double threshold, int buffer);
+  //the loss sums of the mobile sizes skip the immobile partners n of |c(n)| <= tol times the largest
+  //|c| of their species, in the residual and the Jacobian, until the next call; c_v, c_i: largest
+  //|c(n)| over the points at the start of the step (by size, index 0 unused), tol = 0 keeps every
+  //partner. The equations of the immobile groups keep all their terms: relative to them the
+  //skipped pairs are not small
+  void setSignificantSizes(const std::vector<double> & c_v, const std::vector<double> & c_i, double tol);
+  //size n is a partner of the loss sums, '+': vacancy; '-': intersitial
+  bool significant(int n) const {return (n>0)? _significant_v[n] : _significant_i[-n];}
+  //the same as ascending runs of sizes first..last, the first one from size 1
+  typedef std::vector<std::pair<int,int> > SizeRuns;
+  const SizeRuns & significantRuns(GSpecies species) const {return (species == G_V)? _runs_v : _runs_i;}
+  //mobile-immobile pairs skipped and all of them in the active range, by setSignificantSizes()
+  unsigned long skippedPairs() const {return _skipped_pairs;}
+  unsigned long reactingPairs() const {return _reacting_pairs;}
+  //largest over the mobile sizes n of sum_j absorb(n,j)*|c(j)| over the skipped partners j relative
+  //to that over all partners, a bound on the relative error of their loss rates at the start of the step
+  double skipBound() const {return _skip_bound;}
+  //group holding size n = 1..maxSizeV()/maxSizeI(), dense lookup rebuilt with the scheme
+  int CurrentGroupV(int n) const {return _group_v[n];}
+  int CurrentGroupI(int n) const {return _group_i[n];}
+  //the same by size for a species (index 0 unused), and n-avg of the group holding n
+  const std::vector<int> & sizeGroups(GSpecies species) const {return (species == G_V)? _group_v : _group_i;}
+  const std::vector<double> & sizeOffsets(GSpecies species) const {return (species == G_V)? _offset_v : _offset_i;}
+
+  //rate lookups from the dense tables, '+': vacancy; '-': intersitial
+  inline double _emit(int) const;//return kth group constant based on single shape function
+  inline double _disl(int) const;//return dislocation sink strenght based on shape function
+  inline double _diff(int) const;//return diffusion coefficient based on shape function
+  inline double _absorb(int,int) const;//return kth,jth group constant based on double shape functions
+
+  //size distribution of a species from its group coefficients (L0, L1 of each group in turn),
+  //shared by the grouped kernels and auxkernels of a thread and rebuilt only when the coefficients change
+  const GSizeDistribution & sizeDistribution(GSpecies, const std::vector<double> &, unsigned int) const;
+  //the same into a distribution of the caller, for the kernels coupled to the neighbouring groups only
+  void sizeDistribution(GSpecies, const std::vector<double> &, GSizeDistribution &) const;
+  //loss sums sum_j c(j)*absorb(n,j) of the single size groups n over the partners GMobile reacts them
+  //with (all sizes of the other species, own sizes up to maxSize-n), by size; computed for all n at
+  //once from the size distributions and shared by the kernels of a thread
+  const std::vector<double> & mobileLoss(GSpecies, const GSizeDistribution &, const GSizeDistribution &, unsigned int) const;
+  //coagulation gains sum_{i<=n/2} c(n-i)*c(i)*absorb(n-i,i) of the same groups, see GGainConvolution
+  const std::vector<double> & mobileGain(GSpecies, const GSizeDistribution &, const GSizeDistribution &, unsigned int) const;
+  //evaluate the gains among the mobile sizes with FFTs where the rates allow it, tol: relative
+  //accuracy of the low rank rate approximation; takes effect with the next rate table
+  void setGainConvolution(bool fft, double tol);
+  //immobile-mobile absorption factors as f(k)*g(j), see GSeparableRates
+  bool separableRates() const {return _rates.separable;}
+  //change with every new group scheme, active range or set of significant sizes, and with every new rate table
+  int schemeId() const {return _scheme_id;}
+  int ratesId() const {return _rates_id;}
+  //moments sum_k (k-avg)^m*rate over the sizes k of group g the interior of its L1 equation
+  //sums, so sum_k c(k)*rate = L0*moment 0 + L1*moment 1; m = 0,1, '+': vacancy; '-': intersitial.
+  //absorbMoment: partners j of the same species with k+j in g, of the other species with k-|j| in g
+  inline double absorbMoment(int g, int m, int j) const;
+  inline double emitMoment(int g, int m) const;//all k in g
+
+  int maxSizeV() const {return _max_v;}
+  int maxSizeI() const {return _max_i;}
+  int maxMobileV() const {return _v_size;}
+  int maxMobileI() const {return _i_size;}
+
+  std::vector<int> GroupScheme_v;
+  std::vector<int> GroupScheme_i;
+  double* GroupScheme_v_sq;//dispersion
+  double* GroupScheme_i_sq;//dispersion
+  double* GroupScheme_v_avg;//group avg
+  double* GroupScheme_i_avg;//group avg
+  int* GroupScheme_v_del;//group del
+  int* GroupScheme_i_del;//group del
+  double _atomic_vol;
+
+protected:
+  //report an inconsistent scheme, throws std::runtime_error unless overridden
+  virtual void schemeError(const std::string &) const;
+  //call after every change of _rates or of the group scheme
+  void ratesUpdated();
+  //dispersion, averages and size index of the groups, after every change of the boundaries
+  void schemeUpdated();
+  //runs from the size flags, after every change of them or of the scheme
+  void significantSizesUpdated();
+  //weight of every size above the single size groups for adaptedScheme(), false if nothing to adapt
+  bool schemeWeights(GSpecies, const std::vector<double> & c, std::vector<double> & w) const;
+
+  struct MobileSums
+  {
+    MobileSums() : dist_v(NULL), dist_i(NULL), stamp_v(-1), stamp_i(-1), scheme_id(-1), rates_id(-1) {}
+    const GSizeDistribution * dist_v;//distributions the sums were built from
+    const GSizeDistribution * dist_i;
+    int stamp_v;
+    int stamp_i;
+    int scheme_id;
+    int rates_id;
+    std::vector<double> loss_v;
+    std::vector<double> loss_i;
+    std::vector<double> gain_v;
+    std::vector<double> gain_i;
+    std::vector<double> prefix;
+    std::vector<std::complex<double> > work;
+  };
+  //loss and gain sums for the distributions, rebuilt only when they changed
+  const MobileSums & mobileSums(const GSizeDistribution &, const GSizeDistribution &, unsigned int) const;
+  //loss sums of the single size groups of one species, see mobileLoss()
+  void mobileLossSums(GSpecies, const GSizeDistribution & own, const GSizeDistribution & other,
+                      std::vector<double> & loss, std::vector<double> & prefix) const;
+  //gain sums of the same groups, see mobileGain()
+  void mobileGainSums(GSpecies, const GSizeDistribution & own, MobileSums & sums, std::vector<double> & gain) const;
+
+  struct GroupMoments
+  {
+    int mobile_own;//partner sizes tabulated
+    int mobile_other;
+    std::vector<double> own;//[(2*(g-1)+m)*mobile_own+j-1]
+    std::vector<double> other;//[(2*(g-1)+m)*mobile_other+j-1]
+    std::vector<double> emit;//[2*(g-1)+m]
+  };
+  //moment tables of one species from the current rates and scheme
+  void groupMoments(GSpecies, GroupMoments &) const;
+
+  SchemeType _scheme_type;
+  double _dr_coef;
+  int _Ng_v;
+  int _Ng_i;
+  int _num_v;
+  int _num_i;
+  int _v_size;
+  int _i_size;
+  int _single_v_group;
+  int _single_i_group;
+
+  int _max_v;//largest v size covered by the scheme
+  int _max_i;//largest i size covered by the scheme
+  int _active_v;//see activeGroups()
+  int _active_i;
+  std::vector<int> _static_v;//boundaries of setGroupScheme(), the reference of adaptedScheme()
+  std::vector<int> _static_i;
+  std::vector<int> _group_v;//by size, see CurrentGroupV()
+  std::vector<int> _group_i;
+  std::vector<double> _offset_v;//by size, see sizeOffsets()
+  std::vector<double> _offset_i;
+  std::vector<char> _significant_v;//by size, see significant()
+  std::vector<char> _significant_i;
+  SizeRuns _runs_v;//see significantRuns()
+  SizeRuns _runs_i;
+  unsigned long _skipped_pairs;
+  unsigned long _reacting_pairs;
+  double _skip_bound;
+
+  GRateTable _rates;
+  int _rates_id;//changes with every new _rates
+  bool _gain_fft;
+  double _gain_tol;
+  GGainConvolution _gain_v;//among the mobile sizes, set up by ratesUpdated()
+  GGainConvolution _gain_i;
+  GroupMoments _moments_v;//set up by ratesUpdated()
+  GroupMoments _moments_i;
+
+  int _scheme_id;//changes with every new group scheme
+  mutable std::vector<GSizeDistribution> _dist_v;//per thread
+  mutable std::vector<GSizeDistribution> _dist_i;
+  mutable std::vector<MobileSums> _sums;
+
+private:
+  GGroupScheme(const GGroupScheme &);
+  GGroupScheme & operator=(const GGroupScheme &);
+};
+
+double
+GGroupScheme::_emit(int clustersize) const
+{
+  return (clustersize>0)? _rates.emit_v[clustersize] : _rates.emit_i[-clustersize];
+}
+
+double
+GGroupScheme::_disl(int clustersize) const
+{
+  if(clustersize>0)
+    return (clustersize<=_v_size)? _rates.disl_v[clustersize] : 0.0;
+  return (-clustersize<=_i_size)? _rates.disl_i[-clustersize] : 0.0;
+}
+
+double
+GGroupScheme::_diff(int clustersize) const
+{
+  if(clustersize>0)
+    return (clustersize<=_v_size)? _rates.diff_v[clustersize] : 0.0;
+  return (-clustersize<=_i_size)? _rates.diff_i[-clustersize] : 0.0;
+}
+
+//the rate laws are symmetric in the reacting pair, so a pair is looked up with its mobile partner second
+double
+GGroupScheme::_absorb(int clustersize1, int clustersize2) const
+{
+  int i = std::abs(clustersize1);
+  int j = std::abs(clustersize2);
+  if(clustersize1>0 && clustersize2>0){//vv
+    if(j<=_v_size) return _rates.absorb_vv[i*_v_size+j-1];
+    if(i<=_v_size) return _rates.absorb_vv[j*_v_size+i-1];
+  }
+  else if(clustersize1>0 && clustersize2<0){//vi
+    if(j<=_i_size) return _rates.absorb_vi[i*_i_size+j-1];
+    if(i<=_v_size) return _rates.absorb_iv[j*_v_size+i-1];
+  }
+  else if(clustersize1<0 && clustersize2>0){//iv
+    if(j<=_v_size) return _rates.absorb_iv[i*_v_size+j-1];
+    if(i<=_i_size) return _rates.absorb_vi[j*_i_size+i-1];
+  }
+  else{//ii
+    if(j<=_i_size) return _rates.absorb_ii[i*_i_size+j-1];
+    if(i<=_i_size) return _rates.absorb_ii[j*_i_size+i-1];
+  }
+  return 0.0;//both immobile
+}
+
+double
+GGroupScheme::absorbMoment(int g, int m, int j) const
+{
+  const GroupMoments & moments = (g>0)? _moments_v : _moments_i;
+  int row = 2*(std::abs(g)-1)+m;
+  if((g>0) == (j>0))
+    return (std::abs(j)<=moments.mobile_own)? moments.own[row*moments.mobile_own+std::abs(j)-1] : 0.0;
+  return (std::abs(j)<=moments.mobile_other)? moments.other[row*moments.mobile_other+std::abs(j)-1] : 0.0;
+}
+
+double
+GGroupScheme::emitMoment(int g, int m) const
+{
+  return ((g>0)? _moments_v : _moments_i).emit[2*(std::abs(g)-1)+m];
+}
+
+#endif //GGROUPSCHEME_H
@@ -17,9 +17,10 @@
 #define GIRON_H
 
 #include "GeneralUserObject.h"
-#include "GMaterialConstants.h"
+#include "GPolicyMaterial.h"
+#include "GIronRates.h"
 
-class GIron : public GMaterialConstants
+class GIron : public GPolicyMaterial<GIronRates>
 {
 public:
   GIron(const InputParameters & parameters);
@@ -28,15 +29,6 @@ public:
   virtual void initialize();
   virtual void execute();
   virtual void finalize();
-
-  Real absorb(int,int,std::string,std::string,double,int,int) const;
-  Real emit(int,int,double,std::string,std::string,int,int) const;
-  Real disl_ksq(int,std::string,double,int=1) const;
-  double energy(int,std::string,std::string) const;
-  double D_prefactor(int,std::string) const;
-  double diff(int, std::string,double) const;
-
-private:
 };
 
 template<>
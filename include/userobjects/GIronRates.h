@@ -0,0 +1,130 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+
+#ifndef GIRONRATES_H
+#define GIRONRATES_H
+
+#include "GRateLaws.h"
+#include <cmath>
+
+/**
+ * Rate laws of pure iron under neutron irradiation
+ * calculate: Neutron-induced swelling and embrittlement of pure iron and pure nickel irradiated in the BN-350 and BOR-60 fast reactors
+ * parameters: Efficient simulation of kinetics of radiation induced defects: A cluster dynamics approach
+ */
+class GIronRates
+{
+public:
+  GIronRates(double v_bias, double i_bias, double rho_d);
+
+  static constexpr double INF = 100;
+  static constexpr double PI = 3.14159265359;
+  static constexpr double Vatom = 1.205e-11;//iron atom volume um^3
+  static constexpr double Boltz_const = 8.6173315e-5;//boltzmann constant eV/K
+
+  template<GSpecies S, GEnergyType E> double energy(int) const;//unit:eV
+  template<GSpecies S> double D_prefactor(int) const {return 8.2e5;}//um^2/s
+  template<GSpecies S> double diff(int,double) const;//in um^2/s
+  template<GSpecies A, GSpecies B> double absorb(int,int,double,int,int) const;
+  template<GSpecies A, GSpecies B> double absorbPair(int,int,int,double) const {return 0.0;}//no pair absorption yet, as GMaterialConstants::absorbVV
+  template<GSpecies S> double emit(int,int,double,int,int) const;
+  template<GSpecies S> double disl_ksq(int,double,int=1) const;
+
+private:
+  double _v_bias;
+  double _i_bias;
+  double _rho_d;
+};
+
+inline
+GIronRates::GIronRates(double v_bias, double i_bias, double rho_d) :
+    _v_bias(v_bias),
+    _i_bias(i_bias),
+    _rho_d(rho_d)
+{
+}
+
+template<GSpecies S, GEnergyType E>
+inline double
+GIronRates::energy(int s) const
+{
+  if(S == G_V && E == G_MIGRATION){
+    switch(s){
+      case 1: return 0.83;
+      case 2: return 0.62;
+      case 3: return 0.35;
+      case 4: return 0.48;
+      default: return INF;
+    }
+  }
+  if(S == G_I && E == G_MIGRATION){
+    switch(s){
+      case 1: return 0.34;
+      case 2: return 0.42;
+      case 3: return 0.43;
+      default: return INF;
+    }
+  }
+  if(S == G_V){
+    switch(s){
+      case 1: return INF;
+      case 2: return 0.30;
+      case 3: return 0.37;
+      case 4: return 0.62;
+      case 5: return 0.73;
+      default: return 2.2 + (0.3-2.2)/(std::pow(2.0,2.0/3)-1) * (std::pow(s,2.0/3)-std::pow(s-1,2.0/3));//capillary law
+    }
+  }
+  switch(s){
+    case 1: return INF;
+    case 2: return 0.83;
+    case 3: return 0.92;
+    case 4: return 1.64;
+    default: return 3.64 - 4.78378*(std::pow(s,2.0/3)-std::pow(s-1,2.0/3));//capillary law
+  }
+}
+
+template<GSpecies S>
+inline double
+GIronRates::diff(int S1, double T) const
+{
+  return D_prefactor<S>(S1)*std::exp(-energy<S,G_MIGRATION>(S1)/Boltz_const/T);
+}
+
+//tag1, tag2 denotes the mobility of the two partners; 1: mobile, 0: immobile
+template<GSpecies A, GSpecies B>
+inline double
+GIronRates::absorb(int S1, int S2, double T, int tag1, int tag2) const
+{
+  if(tag1==0 && tag2==0) return 0.0;
+  double r_vi = 0.65e-3;//recombination radius in um
+  double r1 = std::pow(S1*Vatom*3/4/PI,1.0/3); //cluster effective radius
+  double r2 = std::pow(S2*Vatom*3/4/PI,1.0/3); //cluster effective radius
+  return 4*PI*(diff<A>(S1,T)*tag1+diff<B>(S2,T)*tag2)*(r1+r2+r_vi);
+}
+
+//for now only consider self species emmision, S1 emits S2, S1==1
+template<GSpecies S>
+inline double
+GIronRates::emit(int S1, int S2, double T, int tag1, int tag2) const
+{
+  if(S1 > S2 && S2==1)
+    return absorb<S,S>(S1,S2,T,tag1,tag2)/(Vatom) *std::exp(-energy<S,G_BINDING>(S1)/Boltz_const/T);//unit:/s only emit point defect of the same species
+  return 0.0;
+}
+
+//dislocation sink rate k^2*Cj*Dj, return k^2*Dj in this function, where k^2= z*rho_d, P230/839 Was book
+template<GSpecies S>
+inline double
+GIronRates::disl_ksq(int S1, double T, int tag) const
+{
+  double bias = (S == G_V)? _v_bias : _i_bias;
+  return tag * diff<S>(S1,T) * _rho_d * bias;
+}
+
+#endif //GIRONRATES_H
@@ -17,6 +17,7 @@
 #define GMATERIALCONSTANTS_H
 
 #include "GeneralUserObject.h"
+#include "GRateLaws.h"
 
 class GMaterialConstants : public GeneralUserObject
 {
@@ -35,9 +36,20 @@ public:
   virtual Real emit(int,int,double,std::string,std::string,int,int) const;
   virtual Real disl_ksq(int,std::string,double,int=1) const;//1 denotes mobile
   virtual Real diff(int,std::string,double) const;
+
+  //species-tagged interface, the defaults forward to the string interface above
+  virtual Real absorb(int,int,GSpecies,GSpecies,double,int,int) const;
+  virtual Real emit(int,int,double,GSpecies,int,int) const;
+  virtual Real disl_ksq(int,GSpecies,double,int=1) const;
+  virtual Real diff(int,GSpecies,double) const;
+
+  //fill the rate tables of GGroup at temperature T, see GTabulateRates
+  virtual void tabulate(GRateTable &,int,int,int,int,double) const;
   Real atomic_vol;
 
 protected:
+  static GSpecies speciesFromName(const std::string &);
+
   Real _rho_d;
   Real _i_bias;
   Real _v_bias;
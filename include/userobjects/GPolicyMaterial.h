@@ -0,0 +1,85 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+
+#ifndef GPOLICYMATERIAL_H
+#define GPOLICYMATERIAL_H
+
+#include "GMaterialConstants.h"
+
+/**
+ * Material whose rate laws are given by a policy class templated on
+ * GSpecies, with the interface of GTabulateRates plus the tag-based
+ *   template<GSpecies A, GSpecies B> double absorb(int S1, int S2, double T, int tag1, int tag2) const;
+ * used by GroupConstant. GGroup tabulates it
+ * through one virtual call with every rate law inlined; the string and
+ * tagged virtual interfaces of GMaterialConstants are kept as adapters
+ * for GroupConstant and the input files.
+ */
+template<class Rates>
+class GPolicyMaterial : public GMaterialConstants
+{
+public:
+  GPolicyMaterial(const InputParameters & parameters, const Rates & rates) :
+      GMaterialConstants(parameters),
+      _rates(rates)
+  {
+  }
+
+  virtual ~GPolicyMaterial(){}
+
+  virtual Real absorb(int S1,int S2,std::string C1,std::string C2,double T,int tag1,int tag2) const
+  {
+    return absorb(S1,S2,speciesFromName(C1),speciesFromName(C2),T,tag1,tag2);
+  }
+  virtual Real emit(int S1,int S2,double T,std::string C1,std::string,int tag1,int tag2) const
+  {
+    return emit(S1,S2,T,speciesFromName(C1),tag1,tag2);
+  }
+  virtual Real disl_ksq(int S1,std::string C1,double T,int tag=1) const
+  {
+    return disl_ksq(S1,speciesFromName(C1),T,tag);
+  }
+  virtual Real diff(int S1,std::string C1,double T) const
+  {
+    return diff(S1,speciesFromName(C1),T);
+  }
+
+  virtual Real absorb(int S1,int S2,GSpecies C1,GSpecies C2,double T,int tag1,int tag2) const
+  {
+    if(C1 == G_V)
+      return (C2 == G_V)? _rates.template absorb<G_V,G_V>(S1,S2,T,tag1,tag2) : _rates.template absorb<G_V,G_I>(S1,S2,T,tag1,tag2);
+    return (C2 == G_V)? _rates.template absorb<G_I,G_V>(S1,S2,T,tag1,tag2) : _rates.template absorb<G_I,G_I>(S1,S2,T,tag1,tag2);
+  }
+  virtual Real absorbVV(int S1,int S2,int flag,double T) const {return _rates.template absorbPair<G_V,G_V>(S1,S2,flag,T);}
+  virtual Real absorbVI(int S1,int S2,int flag,double T) const {return _rates.template absorbPair<G_V,G_I>(S1,S2,flag,T);}
+  virtual Real absorbII(int S1,int S2,int flag,double T) const {return _rates.template absorbPair<G_I,G_I>(S1,S2,flag,T);}
+  virtual Real emit(int S1,int S2,double T,GSpecies C1,int tag1,int tag2) const
+  {
+    return (C1 == G_V)? _rates.template emit<G_V>(S1,S2,T,tag1,tag2) : _rates.template emit<G_I>(S1,S2,T,tag1,tag2);
+  }
+  virtual Real disl_ksq(int S1,GSpecies C1,double T,int tag=1) const
+  {
+    return (C1 == G_V)? _rates.template disl_ksq<G_V>(S1,T,tag) : _rates.template disl_ksq<G_I>(S1,T,tag);
+  }
+  virtual Real diff(int S1,GSpecies C1,double T) const
+  {
+    return (C1 == G_V)? _rates.template diff<G_V>(S1,T) : _rates.template diff<G_I>(S1,T);
+  }
+
+  virtual void tabulate(GRateTable & table,int max_v,int max_i,int mobile_v,int mobile_i,double T) const
+  {
+    GTabulateRates(_rates,max_v,max_i,mobile_v,mobile_i,T,table);
+  }
+
+  const Rates & rates() const {return _rates;}
+
+protected:
+  const Rates _rates;
+};
+
+#endif //GPOLICYMATERIAL_H
@@ -0,0 +1,79 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+
+#ifndef GPRODUCTIONSPECTRUM_H
+#define GPRODUCTIONSPECTRUM_H
+
+#include <string>
+#include <vector>
+
+/**
+ * Cluster production spectrum of a [Sources] block read from the LAMMPS and
+ * SRIM result files instead of source_v_value/source_i_value, as
+ * defects_production.py does:
+ *  - production tables (vcluster_production_*.txt, icluster_production_*.txt):
+ *    "size number [std]" rows after a header line, clusters per displaced atom;
+ *  - or a SRIM PKA spectrum (pka_*.txt: "left right median prop variance" rows,
+ *    keV) convolved with a defect yield table (*_Epka_Ndefects.txt: PKA energies
+ *    in keV, then the surviving Frenkel pairs of a cascade, one line each). The
+ *    PKAs are counted from the NRT displacements of their damage energy, the
+ *    Frenkel pairs are split into sizes by the production tables if given,
+ *    otherwise they are point defects.
+ * With dpa_rate > 0 the production is per unit volume and time, dpa_rate/atomic_vol
+ * displaced atoms. The spectrum can be cached in a binary file, reused while the
+ * input files and parameters are unchanged. Errors throw std::runtime_error.
+ */
+class GProductionSpectrum
+{
+public:
+  struct Parameters
+  {
+    Parameters();
+
+    std::string v_table;//production tables, "" if not used
+    std::string i_table;
+    std::string pka;//PKA spectrum and defect yield, "" if not used
+    std::string yield;
+    double dpa_rate;//0: per displaced atom
+    double atomic_vol;
+    double displacement_energy;//keV, NRT displacements of the PKAs
+    double atomic_mass;//Lindhard partition of the PKA energy
+    double atomic_number;
+    std::string cache;//binary cache file, "" if not used
+  };
+
+  //read (or take from the cache) the spectrum of p
+  void load(const Parameters & p);
+
+  //sizes with a nonzero production and their production
+  const std::vector<int> & sizes(bool vacancy) const {return vacancy? _size_v : _size_i;}
+  const std::vector<double> & values(bool vacancy) const {return vacancy? _value_v : _value_i;}
+  //read from the cache by the last load()
+  bool cached() const {return _cached;}
+
+  //surviving Frenkel pairs per NRT displacement of the PKA spectrum
+  static double survivalFraction(const Parameters & p);
+  //damage energy of a PKA of energy E (keV) in its own lattice, Lindhard-Robinson
+  static double damageEnergy(double E, double A, double Z);
+
+protected:
+  //sizes and numbers of a production table, rows of zero number dropped
+  static void readTable(const std::string & file, std::vector<int> & sizes, std::vector<double> & numbers);
+  //identifies the inputs: parameters, and the length and time of change of every file
+  static std::string cacheKey(const Parameters & p);
+  bool readCache(const std::string & file, const std::string & key);
+  void writeCache(const std::string & file, const std::string & key) const;
+
+  std::vector<int> _size_v;
+  std::vector<int> _size_i;
+  std::vector<double> _value_v;
+  std::vector<double> _value_i;
+  bool _cached;
+};
+
+#endif //GPRODUCTIONSPECTRUM_H
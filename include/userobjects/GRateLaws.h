@@ -0,0 +1,181 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+
+#ifndef GRATELAWS_H
+#define GRATELAWS_H
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+/**
+ * Compile-time tags for the cluster rate laws. Material rate policies are
+ * templates on these tags, so a law evaluated for a fixed species and energy
+ * type is resolved by the compiler instead of by string compares.
+ */
+enum GSpecies
+{
+  G_V = 0,
+  G_I = 1
+};
+
+enum GEnergyType
+{
+  G_MIGRATION = 0,
+  G_BINDING = 1
+};
+
+inline const char *
+GSpeciesName(GSpecies species)
+{
+  return (species == G_V)? "V":"I";
+}
+
+//map the "V"/"I" names of the string interface to a tag, false if unknown
+inline bool
+GSpeciesFromName(const std::string & name, GSpecies & species)
+{
+  if(name == "V") species = G_V;
+  else if(name == "I") species = G_I;
+  else return false;
+  return true;
+}
+
+/**
+ * Rate constants at a single temperature, stored densely by cluster size.
+ * Single-size tables are indexed directly by the (positive) cluster size;
+ * absorption tables are indexed by [size*n_mobile + (mobile_size-1)] where
+ * the second partner runs over the mobile sizes of its species only, since a
+ * pair with two immobile partners never reacts.
+ */
+struct GRateTable
+{
+  GRateTable() : separable(false) {}
+
+  std::vector<double> emit_v;
+  std::vector<double> emit_i;
+  std::vector<double> disl_v;
+  std::vector<double> disl_i;
+  std::vector<double> diff_v;
+  std::vector<double> diff_i;
+  std::vector<double> absorb_vv;//v size with mobile v
+  std::vector<double> absorb_vi;//v size with mobile i
+  std::vector<double> absorb_iv;//i size with mobile v
+  std::vector<double> absorb_ii;//i size with mobile i
+
+  //with separable set, absorb_xy[k*n_mobile+j-1] = absorb_xy[k*n_mobile]*mobile_xy[j-1]
+  //for every immobile size k, see GFactorRateTable
+  bool separable;
+  std::vector<double> mobile_vv;
+  std::vector<double> mobile_vi;
+  std::vector<double> mobile_iv;
+  std::vector<double> mobile_ii;
+};
+
+/**
+ * Rate policies whose absorption of an immobile cluster k by a mobile one j
+ * factors as f(k)*g(j), e.g. a capture radius times the mobile diffusivity,
+ * specialize this to true. Loss sums over the immobile partners then reduce
+ * to prefix sums, see GGroupScheme::mobileLoss().
+ */
+template<class Rates>
+struct GSeparableRates
+{
+  static const bool value = false;
+};
+
+//factor a single absorption table, false if its immobile rows are not multiples of one row
+inline bool
+GFactorAbsorbTable(const std::vector<double> & table, int max_size, int mobile_own, int n_mobile, std::vector<double> & factor)
+{
+  factor.assign(n_mobile,1.0);
+  if(n_mobile == 0 || max_size <= mobile_own) return true;
+  const double * first = &table[(mobile_own+1)*n_mobile];
+  if(first[0] <= 0.0) return false;
+  for(int j=0;j<n_mobile;j++)
+    factor[j] = first[j]/first[0];
+  for(int k=mobile_own+1;k<=max_size;k++){
+    const double * row = &table[k*n_mobile];
+    for(int j=1;j<n_mobile;j++)
+      if(std::abs(row[j]-row[0]*factor[j]) > 1.0e-12*std::abs(row[j]))
+        return false;
+  }
+  return true;
+}
+
+//set the mobile factors of a table filled by GTabulateRates or interpolated between two of them;
+//only materials declaring GSeparableRates are factored, the check guards the declaration
+inline void
+GFactorRateTable(GRateTable & table, bool separable)
+{
+  int max_v = (int)table.emit_v.size()-1, max_i = (int)table.emit_i.size()-1;
+  int mobile_v = (int)table.diff_v.size()-1, mobile_i = (int)table.diff_i.size()-1;
+  table.separable = separable
+      && GFactorAbsorbTable(table.absorb_vv,max_v,mobile_v,mobile_v,table.mobile_vv)
+      && GFactorAbsorbTable(table.absorb_vi,max_v,mobile_v,mobile_i,table.mobile_vi)
+      && GFactorAbsorbTable(table.absorb_iv,max_i,mobile_i,mobile_v,table.mobile_iv)
+      && GFactorAbsorbTable(table.absorb_ii,max_i,mobile_i,mobile_i,table.mobile_ii);
+}
+
+/**
+ * Tabulate every rate of a rate policy for sizes 1..max_v/max_i at temperature T,
+ * the first mobile_v/mobile_i sizes being mobile. Rates provides
+ *   template<GSpecies S> double emit(int S1, int S2, double T, int tag1, int tag2) const;
+ *   template<GSpecies S> double disl_ksq(int S1, double T, int tag) const;
+ *   template<GSpecies S> double diff(int S1, double T) const;
+ *   template<GSpecies A, GSpecies B> double absorbPair(int S1, int S2, int flag, double T) const;
+ * where flag = tag1 + 2*tag2 as for GMaterialConstants::absorbVV and only <V,V>, <V,I>
+ * and <I,I> pairs are asked for.
+ */
+template<class Rates>
+void
+GTabulateRates(const Rates & rates, int max_v, int max_i, int mobile_v, int mobile_i, double T, GRateTable & table)
+{
+  //index 0 unused
+  table.emit_v.assign(max_v+1,0.0);
+  table.emit_i.assign(max_i+1,0.0);
+  for(int n=1;n<=max_v;n++)
+    table.emit_v[n] = rates.template emit<G_V>(n,1,T,(n<=mobile_v)?1:0,1);
+  for(int n=1;n<=max_i;n++)
+    table.emit_i[n] = rates.template emit<G_I>(n,1,T,(n<=mobile_i)?1:0,1);
+
+  table.disl_v.assign(mobile_v+1,0.0);
+  table.diff_v.assign(mobile_v+1,0.0);
+  for(int n=1;n<=mobile_v;n++){
+    table.disl_v[n] = rates.template disl_ksq<G_V>(n,T,1);
+    table.diff_v[n] = rates.template diff<G_V>(n,T);
+  }
+  table.disl_i.assign(mobile_i+1,0.0);
+  table.diff_i.assign(mobile_i+1,0.0);
+  for(int n=1;n<=mobile_i;n++){
+    table.disl_i[n] = rates.template disl_ksq<G_I>(n,T,1);
+    table.diff_i[n] = rates.template diff<G_I>(n,T);
+  }
+
+  //the second partner is mobile, so the flag only depends on the first one
+  table.absorb_vv.assign((max_v+1)*mobile_v,0.0);
+  table.absorb_iv.assign((max_i+1)*mobile_v,0.0);
+  for(int j=1;j<=mobile_v;j++){
+    for(int k=1;k<=max_v;k++)
+      table.absorb_vv[k*mobile_v+j-1] = rates.template absorbPair<G_V,G_V>(k,j,((k<=mobile_v)?1:0)+2,T);
+    for(int k=1;k<=max_i;k++)
+      table.absorb_iv[k*mobile_v+j-1] = rates.template absorbPair<G_V,G_I>(j,k,1+2*((k<=mobile_i)?1:0),T);
+  }
+  table.absorb_vi.assign((max_v+1)*mobile_i,0.0);
+  table.absorb_ii.assign((max_i+1)*mobile_i,0.0);
+  for(int j=1;j<=mobile_i;j++){
+    for(int k=1;k<=max_v;k++)
+      table.absorb_vi[k*mobile_i+j-1] = rates.template absorbPair<G_V,G_I>(k,j,((k<=mobile_v)?1:0)+2,T);
+    for(int k=1;k<=max_i;k++)
+      table.absorb_ii[k*mobile_i+j-1] = rates.template absorbPair<G_I,G_I>(k,j,((k<=mobile_i)?1:0)+2,T);
+  }
+
+  GFactorRateTable(table,GSeparableRates<Rates>::value);
+}
+
+#endif //GRATELAWS_H
@@ -0,0 +1,83 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+
+#ifndef GSIZEDISTRIBUTION_H
+#define GSIZEDISTRIBUTION_H
+
+#include <vector>
+
+/**
+ * Size distribution of one species in the grouping method,
+ * c(n) = L0 + L1*(n-avg) of the group holding n, reconstructed from the group
+ * coefficients ordered L0, L1 of group 1, L0, L1 of group 2, ...
+ * The size to group index and the offsets n-avg belong to the scheme
+ * (GGroupScheme) and are shared by all distributions of a species.
+ * The coefficients it was built from are kept, so a request with the same
+ * coefficients (the next object on the same qp or node) returns the stored
+ * distribution instead of rebuilding it, and other coefficients of the same scheme rebuild only the
+ * groups that changed. Only the active groups are reconstructed,
+ * c(n) is zero above activeSize().
+ */
+class GSizeDistribution
+{
+public:
+  GSizeDistribution() : _scheme_id(-1), _stamp(0), _active(0), _group(NULL), _offset(NULL) {}
+
+  //scheme: group boundaries x_0..x_Ng, active: groups 1..active reconstructed,
+  //group/offset: group and n-avg by size; rebuilds only what changed
+  void reconstruct(const std::vector<int> & scheme, int active, const std::vector<int> & group, const std::vector<double> & offset,
+                   const std::vector<double> & coef, int scheme_id);
+
+  int maxSize() const {return _c.size()-1;}
+  int activeSize() const {return _active;}//largest size of the active groups
+  double conc(int n) const {return _c[n];}//n in 1..maxSize()
+  const std::vector<double> & concentrations() const {return _c;}//by size, index 0 unused
+  int group(int n) const {return (*_group)[n];}
+  double offset(int n) const {return (*_offset)[n];}//n-avg of its group, d c(n)/d L1
+  const std::vector<double> & coefficients() const {return _coef;}
+  int stamp() const {return _stamp;}//changes with every rebuild
+
+private:
+  int _scheme_id;
+  int _stamp;
+  int _active;
+  std::vector<double> _coef;
+  std::vector<double> _c;//by size, index 0 unused
+  const std::vector<int> * _group;
+  const std::vector<double> * _offset;
+};
+
+inline void
+GSizeDistribution::reconstruct(const std::vector<int> & scheme, int active, const std::vector<int> & group, const std::vector<double> & offset,
+                               const std::vector<double> & coef, int scheme_id)
+{
+  bool all = (scheme_id != _scheme_id);
+  if(all){
+    _c.assign(group.size(),0.0);
+    _group = &group;
+    _offset = &offset;
+    _scheme_id = scheme_id;
+    _active = (active>0)? scheme[active] : 0;
+  }
+  else if(coef == _coef)
+    return;
+
+  //within a scheme only the groups whose coefficients changed, a kernel coupled to
+  //a few groups changes only those from one point to the next
+  _stamp++;
+  const double * off = &offset[0];
+  for(int g=1;g<=active;g++){
+    double L0 = coef[2*(g-1)], L1 = coef[2*(g-1)+1];
+    if(!all && L0 == _coef[2*(g-1)] && L1 == _coef[2*(g-1)+1]) continue;
+    for(int n=scheme[g-1]+1;n<=scheme[g];n++)
+      _c[n] = L0+L1*off[n];
+  }
+  _coef = coef;
+}
+
+#endif //GSIZEDISTRIBUTION_H
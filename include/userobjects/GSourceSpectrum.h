@@ -0,0 +1,109 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+
+#ifndef GSOURCESPECTRUM_H
+#define GSOURCESPECTRUM_H
+
+#include "GGroupScheme.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+/**
+ * Defect production of a [Sources] block: clusters of each size produced per unit
+ * volume and time, and the time profile switching it on and off. The spectrum
+ * is turned into rates of the group coefficients, laid out L0, L1 of each group
+ * in turn as the coupled_v_vars and coupled_i_vars lists, so one object applies
+ * it to all groups at once. Shared by GClusterSource, GScalarClusterSource and
+ * the standalone 0D integrator.
+ */
+class GSourceSpectrum
+{
+public:
+  GSourceSpectrum() : _tlimit(std::numeric_limits<double>::max()), _period(0.0), _width(0.0) {}
+
+  //sizes and production of one species, scaled by factor
+  void setSpectrum(GSpecies species, const std::vector<int> & sizes, const std::vector<double> & values, double factor)
+  {
+    std::vector<int> & n = (species == G_V)? _size_v : _size_i;
+    std::vector<double> & v = (species == G_V)? _value_v : _value_i;
+    n = sizes;
+    v.resize(values.size());
+    for(unsigned int k=0;k<values.size();k++)
+      v[k] = values[k]*factor;
+  }
+  //produce until tlimit; with period > 0 only during the first width of every period
+  void setProfile(double tlimit, double period, double width)
+  {
+    _tlimit = tlimit;
+    _period = period;
+    _width = width;
+  }
+  //1 while producing at time t, 0 otherwise
+  double profile(double t) const
+  {
+    if(t >= _tlimit) return 0.0;
+    if(_period > 0.0 && t-_period*std::floor(t/_period) >= _width) return 0.0;
+    return 1.0;
+  }
+  //first time after t at which profile() changes, max() if none
+  double nextSwitch(double t) const
+  {
+    double next = std::numeric_limits<double>::max();
+    if(t < _tlimit) next = _tlimit;
+    if(_period > 0.0 && _width < _period){
+      double start = _period*std::floor(t/_period);
+      double pulse = (t-start < _width)? start+_width : start+_period;
+      if(pulse <= t) pulse += _period;//roundoff at the switch itself
+      next = std::min(next,pulse);
+    }
+    return next;
+  }
+  int maxSize(GSpecies species) const
+  {
+    const std::vector<int> & n = (species == G_V)? _size_v : _size_i;
+    int m = 0;
+    for(unsigned int k=0;k<n.size();k++)
+      m = std::max(m,n[k]);
+    return m;
+  }
+  bool empty() const {return _size_v.empty() && _size_i.empty();}
+
+  //rates of the group coefficients of both species in the current scheme, see GGroupScheme::addSource()
+  void groupRates(const GGroupScheme & gc, std::vector<double> & rate_v, std::vector<double> & rate_i) const
+  {
+    rate_v.assign(2*(gc.GroupScheme_v.size()-1),0.0);
+    rate_i.assign(2*(gc.GroupScheme_i.size()-1),0.0);
+    for(unsigned int k=0;k<_size_v.size();k++)
+      gc.addSource(G_V,_size_v[k],_value_v[k],rate_v);
+    for(unsigned int k=0;k<_size_i.size();k++)
+      gc.addSource(G_I,_size_i[k],_value_i[k],rate_i);
+  }
+  //the same without a scheme, every source size being a single size group: L0 of group n
+  void singleSizeRates(int Ng_v, int Ng_i, std::vector<double> & rate_v, std::vector<double> & rate_i) const
+  {
+    rate_v.assign(2*Ng_v,0.0);
+    rate_i.assign(2*Ng_i,0.0);
+    for(unsigned int k=0;k<_size_v.size();k++)
+      rate_v[2*(_size_v[k]-1)] += _value_v[k];
+    for(unsigned int k=0;k<_size_i.size();k++)
+      rate_i[2*(_size_i[k]-1)] += _value_i[k];
+  }
+
+protected:
+  std::vector<int> _size_v;
+  std::vector<int> _size_i;
+  std::vector<double> _value_v;
+  std::vector<double> _value_i;
+  double _tlimit;
+  double _period;
+  double _width;
+};
+
+#endif //GSOURCESPECTRUM_H
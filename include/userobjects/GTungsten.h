@@ -17,9 +17,10 @@
 #define GTungsten_H
 
 #include "GeneralUserObject.h"
-#include "GMaterialConstants.h"
+#include "GPolicyMaterial.h"
+#include "GTungstenRates.h"
 
-class GTungsten : public GMaterialConstants
+class GTungsten : public GPolicyMaterial<GTungstenRates>
 {
 public:
   GTungsten(const InputParameters & parameters);
@@ -28,21 +29,6 @@ public:
   virtual void initialize();
   virtual void execute();
   virtual void finalize();
-
-  Real absorb(int,int,std::string,std::string,double,int,int) const;
-  Real absorbVV(int,int,int,double) const;
-  Real absorbVI(int,int,int,double) const;
-  Real absorbII(int,int,int,double) const;
-  Real emit(int,int,double,std::string,std::string,int,int) const;
-  Real disl_ksq(int,std::string,double,int=1) const;
-  double energy(int,std::string,std::string) const;
-  double D_prefactor(int,std::string="") const;
-  double diff(int, std::string,double) const;
-
-private:
-  double Ev_formation,Ei_formation,Evb2,Eib2;//description in cpp file
-  double Ei_binding_factor;
-  double Ev_binding_factor;
 };
 
 template<>
@@ -0,0 +1,209 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+
+#ifndef GTUNGSTENRATES_H
+#define GTUNGSTENRATES_H
+
+#include "GRateLaws.h"
+#include <cmath>
+
+/**
+ * Rate laws of tungsten
+ * ref: Microstructural evolution of irradiated tungsten: Ab initio parameterisation of an OKMC model
+ */
+class GTungstenRates
+{
+public:
+  GTungstenRates(double v_bias, double i_bias, double rho_d);
+
+  static constexpr double INF = 100;
+  static constexpr double PI = 3.14159265359;
+  static constexpr double Vatom = 1.5825e-11;//tungsten atom volume um^3
+  static constexpr double Burgers = 2.7366e-4;//burgers vector (um) (sqrt(3)/2*a0)
+  static constexpr double Rvi = 0.65e-3;//vacancy - intersitial reaction distance (um)
+  static constexpr double Boltz_const = 8.6173315e-5;//boltzmann constant eV/K
+
+  template<GSpecies S, GEnergyType E> double energy(int) const;//unit:eV
+  template<GSpecies S> double D_prefactor(int) const;
+  template<GSpecies S> double diff(int,double) const;//in um^2/s
+  template<GSpecies A, GSpecies B> double absorb(int,int,double,int,int) const;
+  template<GSpecies A, GSpecies B> double absorbPair(int,int,int,double) const;
+  template<GSpecies S> double emit(int,int,double,int,int) const;
+  template<GSpecies S> double disl_ksq(int,double,int=1) const;
+
+private:
+  double absorbVV(int,int,int,double) const;
+  double absorbVI(int,int,int,double) const;
+  double absorbII(int,int,int,double) const;
+
+  double _v_bias;
+  double _i_bias;
+  double _rho_d;
+  double Ev_formation,Ei_formation,Evb2,Eib2;
+  double Ei_binding_factor;
+  double Ev_binding_factor;
+};
+
+inline
+GTungstenRates::GTungstenRates(double v_bias, double i_bias, double rho_d) :
+    _v_bias(v_bias),
+    _i_bias(i_bias),
+    _rho_d(rho_d)
+{
+  Ei_formation = 9.96; //interstitial formation energy eV
+  Ev_formation = 3.23; //vacancy formation energy eV
+  Eib2 = 2.12; // binding energy for interstitial cluster size 2
+  Evb2 = -0.1; // binding energy for vacancy cluster size 2
+  Ei_binding_factor = (Eib2-Ei_formation)/ (std::pow(2.0,2.0/3)-1);
+  Ev_binding_factor = (Evb2-Ev_formation)/(std::pow(2.0,2.0/3)-1);
+}
+
+template<GSpecies S, GEnergyType E>
+inline double
+GTungstenRates::energy(int s) const
+{
+  if(E == G_MIGRATION)
+    return (S == G_V)? 1.66 : 0.013;
+  if(S == G_V){
+    switch(s){
+      case 1: return INF;
+      case 2: return Evb2;
+      case 3: return 0.04;
+      case 4: return 0.64;
+      case 5: return 0.72;
+      case 6: return 0.89;
+      case 7: return 0.72;
+      default: return Ev_formation + Ev_binding_factor * (std::pow(s*1.0,2.0/3)-std::pow(s-1.0,2.0/3));//capillary law
+    }
+  }
+  switch(s){
+    case 1: return INF;
+    case 2: return Eib2;
+    case 3: return 3.02;
+    case 4: return 3.6;
+    case 5: return 3.98;
+    case 6: return 4.27;
+    case 7: return 5.39;
+    default: return Ei_formation + Ei_binding_factor * (std::pow(s*1.0,2.0/3)-std::pow(s-1.0,2.0/3));//capillary law
+  }
+}
+
+template<GSpecies S>
+inline double
+GTungstenRates::D_prefactor(int n) const
+{
+  if(S == G_V)
+    return 6.0096*std::pow(10,8.0-3.0*n);//um^2/s
+  return 1.0016e5*std::pow(1.0*n,-0.5);
+}
+
+template<GSpecies S>
+inline double
+GTungstenRates::diff(int S1, double T) const
+{
+  return D_prefactor<S>(S1)*std::exp(-energy<S,G_MIGRATION>(S1)/Boltz_const/T);
+}
+
+//tag1, tag2 denotes the mobility of the two partners; 1: mobile, 0: immobile
+template<GSpecies A, GSpecies B>
+inline double
+GTungstenRates::absorb(int S1, int S2, double T, int tag1, int tag2) const
+{
+  if(tag1==0 && tag2==0) return 0.0;
+  int S = (S1>S2)? S1: S2;
+  double w = std::pow(48.0*PI*PI/Vatom/Vatom*S,1.0/3);
+  return w*Vatom*(diff<A>(S1,T)*tag1+diff<B>(S2,T)*tag2);//add Vatom for unit concern,  P5/19 in ref
+}
+
+template<GSpecies A, GSpecies B>
+inline double
+GTungstenRates::absorbPair(int S1, int S2, int flag, double T) const
+{
+  if(A == G_V && B == G_V) return absorbVV(S1,S2,flag,T);
+  if(A == G_I && B == G_I) return absorbII(S1,S2,flag,T);
+  return absorbVI(S1,S2,flag,T);
+}
+
+//vv reaction; flag=0: both immobile; flag=1: first mobile; flag=2: second mobile; flag=3: both mobile
+inline double
+GTungstenRates::absorbVV(int S1, int S2, int flag, double T) const
+{
+  switch(flag){
+    case 1:
+      return std::pow(48.0*PI*PI/Vatom/Vatom*S2,1.0/3)*Vatom*diff<G_V>(S1,T);
+    case 2:
+      return std::pow(48.0*PI*PI/Vatom/Vatom*S1,1.0/3)*Vatom*diff<G_V>(S2,T);
+    case 3:
+    {
+      int S = (S1>S2)? S1: S2;
+      return std::pow(48.0*PI*PI/Vatom/Vatom*S,1.0/3)*Vatom*(diff<G_V>(S1,T)+diff<G_V>(S2,T));//add Vatom for unit concern,  P5/19 in ref
+    }
+  }
+  return 0.0;
+}
+
+//vi reaction; flag=0: both immobile; flag=1: first mobile; flag=2: second mobile; flag=3: both mobile
+inline double
+GTungstenRates::absorbVI(int S1, int S2, int flag, double T) const
+{
+  switch(flag){
+    case 1:
+      return _v_bias*std::pow(4*PI/Vatom/Burgers*S2,1.0/2)*Vatom*diff<G_V>(S1,T);
+    case 2:
+      return std::pow(48.0*PI*PI/Vatom/Vatom*S1,1.0/3)*Vatom*diff<G_I>(S2,T);
+    case 3:
+      return 4.0*PI*Rvi/Vatom*(diff<G_V>(S1,T)+diff<G_I>(S2,T));//ref: Mean field rate theory and object kinetic monte carlo: a comparison of kinetic models
+  }
+  return 0.0;
+}
+
+//ii reaction; flag=0: both immobile; flag=1: first mobile; flag=2: second mobile; flag=3: both mobile
+inline double
+GTungstenRates::absorbII(int S1, int S2, int flag, double T) const
+{
+  switch(flag){
+    case 1:
+      return _i_bias*std::pow(4*PI/Vatom/Burgers*S2,1.0/2)*Vatom*diff<G_I>(S1,T);
+    case 2:
+      return _i_bias*std::pow(4*PI/Vatom/Burgers*S1,1.0/2)*Vatom*diff<G_I>(S2,T);
+    case 3:
+    {
+      int S = (S1>S2)? S1: S2;
+      return _i_bias*std::pow(4*PI/Vatom/Burgers*S,1.0/2)*Vatom*(diff<G_I>(S1,T)+diff<G_I>(S2,T));//ref: Mean field rate theory and object kinetic monte carlo: a comparison of kinetic models
+    }
+  }
+  return 0.0;
+}
+
+//for now only consider self species emmision, S1 emits S2, S1==1
+template<GSpecies S>
+inline double
+GTungstenRates::emit(int S1, int S2, double T, int tag1, int tag2) const
+{
+  if(S == G_I) return 0.0;//intersitial cluster doesnt' emit.
+  if(S1 > S2 && S2==1)
+    return absorb<S,S>(S1,S2,T,tag1,tag2)/(Vatom) *std::exp(-energy<S,G_BINDING>(S1)/Boltz_const/T);//unit:/s only emit point defect of the same species
+  return 0.0;
+}
+
+template<GSpecies S>
+inline double
+GTungstenRates::disl_ksq(int S1, double T, int tag) const
+{
+  double bias = (S == G_V)? _v_bias : _i_bias;
+  return tag * diff<S>(S1,T) * _rho_d * bias;
+}
+
+//capture of a mobile cluster j by an immobile k is a size factor of k times D(j)
+template<>
+struct GSeparableRates<GTungstenRates>
+{
+  static const bool value = true;
+};
+
+#endif //GTUNGSTENRATES_H
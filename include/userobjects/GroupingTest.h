@@ -17,9 +17,10 @@
 #define GROUPINGTEST_H
 
 #include "GeneralUserObject.h"
-#include "GMaterialConstants.h"
+#include "GPolicyMaterial.h"
+#include "GroupingTestRates.h"
 
-class GroupingTest : public GMaterialConstants
+class GroupingTest : public GPolicyMaterial<GroupingTestRates>
 {
 public:
   GroupingTest(const InputParameters & parameters);
@@ -28,16 +29,6 @@ public:
   virtual void initialize();
   virtual void execute();
   virtual void finalize();
-
-  Real absorb(int,int,std::string,std::string,double,int,int) const;
-  Real emit(int,int,double,std::string,std::string,int,int) const;
-  double energy(int,std::string,std::string) const;
-  double D_prefactor(int,std::string) const;
-  double diff(int, std::string,double) const;
-
-private:
-  Real _i_bias;
-  Real _v_bias;
 };
 
 template<>
@@ -0,0 +1,84 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+
+#ifndef GROUPINGTESTRATES_H
+#define GROUPINGTESTRATES_H
+
+#include "GRateLaws.h"
+#include <cmath>
+
+/**
+ * Rate laws of the test case (table 2) in
+ * GMIC++: Grouping method in C++: an efficient method to solve large number of Master equations
+ */
+class GroupingTestRates
+{
+public:
+  static constexpr double INF = 100;
+  static constexpr double PI = 3.14159265359;
+  static constexpr double Vatom = 1.205e-11;//iron atom volume um^3
+  static constexpr double Boltz_const = 8.6173315e-5;//boltzmann constant eV/K
+
+  template<GSpecies S, GEnergyType E> double energy(int) const;//unit:eV
+  template<GSpecies S> double D_prefactor(int) const {return 1.0e6;}//um^2/s
+  template<GSpecies S> double diff(int,double) const;//in um^2/s
+  template<GSpecies A, GSpecies B> double absorb(int,int,double,int,int) const;
+  template<GSpecies A, GSpecies B> double absorbPair(int S1, int S2, int flag, double T) const {return absorb<A,B>(S1,S2,T,flag&1,flag>>1);}
+  template<GSpecies S> double emit(int,int,double,int,int) const;
+  template<GSpecies S> double disl_ksq(int,double,int=1) const {return 0.0;}//no dislocation sink in the test case
+};
+
+template<GSpecies S, GEnergyType E>
+inline double
+GroupingTestRates::energy(int s) const
+{
+  if(E == G_MIGRATION){
+    if(s==1) return 1.1;//TODO:use 1.3 from another ref: Cluster dynamics simulation of point defect clusters in neutron
+    return INF;
+  }
+  double Ef=1.77,gamma=1.0/1.6022e-7;//ev/um^2
+  double r = std::pow(s*Vatom*3/4/PI,1.0/3); //cluster effective radius
+  return Ef-2*gamma*Vatom/r;
+}
+
+template<GSpecies S>
+inline double
+GroupingTestRates::diff(int S1, double T) const
+{
+  return D_prefactor<S>(S1)*std::exp(-energy<S,G_MIGRATION>(S1)/Boltz_const/T);
+}
+
+//tag1, tag2 denotes the mobility of the two partners; 1: mobile, 0: immobile
+template<GSpecies A, GSpecies B>
+inline double
+GroupingTestRates::absorb(int S1, int S2, double T, int tag1, int tag2) const
+{
+  if(tag1==0 && tag2==0) return 0.0;
+  int S = (S1>S2)? S1: S2;
+  double w = std::pow(48.0*PI*PI/Vatom/Vatom*S,1.0/3);
+  return w*Vatom*(diff<A>(S1,T)*tag1+diff<B>(S2,T)*tag2);//add Vatom for unit concern,  P5/19 in ref
+}
+
+//for now only consider self species emmision, S1 emits S2, S1==1
+template<GSpecies S>
+inline double
+GroupingTestRates::emit(int S1, int S2, double T, int tag1, int tag2) const
+{
+  if(S1 > S2 && S2==1)
+    return absorb<S,S>(S1,S2,T,tag1,tag2)/(Vatom) *std::exp(-energy<S,G_BINDING>(S1)/Boltz_const/T);//unit:/s only emit point defect of the same species
+  return 0.0;
+}
+
+//w(k)*Vatom*D(j) for an immobile k and a mobile j smaller than k
+template<>
+struct GSeparableRates<GroupingTestRates>
+{
+  static const bool value = true;
+};
+
+#endif //GROUPINGTESTRATES_H
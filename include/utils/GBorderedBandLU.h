@@ -0,0 +1,79 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+
+#ifndef GBORDEREDBANDLU_H
+#define GBORDEREDBANDLU_H
+
+#include <vector>
+
+/**
+ * LU factorization for the Newton matrix of the grouped cluster equations.
+ * Only the mobile sizes react with every group, so with the mobile unknowns
+ * (the border) ordered last the matrix is
+ *   [ A  B ]
+ *   [ C  D ]
+ * where A couples each immobile group to its neighbours only and is banded.
+ * A is factored by banded Gaussian elimination with partial pivoting and the
+ * border through the dense Schur complement D - C A^-1 B, which costs
+ * O(n*kl*(kl+ku) + m*m*n) instead of O(n^3) for n unknowns and m border ones.
+ * Without a border and with a full band this is plain dense LU. Used by the
+ * standalone BDF integrator and, for the block of every node, by GClusterPreconditioner.
+ */
+class GBorderedBandLU
+{
+public:
+  GBorderedBandLU();
+
+  /**
+   * Fix the ordering and band from the nonzero pattern of a dense row major
+   * n*n matrix; border lists the unknowns to eliminate last.
+   */
+  void analyse(const std::vector<double> & pattern, unsigned int n, const std::vector<unsigned int> & border);
+  //the same from the entries (rows[k],cols[k]) of a sparse matrix
+  void analyse(const std::vector<unsigned int> & rows, const std::vector<unsigned int> & cols, unsigned int n,
+               const std::vector<unsigned int> & border);
+  //factor the row major n*n matrix, false if it is singular
+  bool factor(const std::vector<double> & mat);
+  //factor the sparse matrix with entries values[k] at (rows[k],cols[k]), repeated entries are summed
+  //and those outside the analysed band dropped
+  bool factor(const std::vector<unsigned int> & rows, const std::vector<unsigned int> & cols, const std::vector<double> & values);
+  //solve in place with the last factorization
+  void solve(std::vector<double> & x) const;
+
+  unsigned int size() const {return _n;}
+  unsigned int lowerBandwidth() const {return _kl;}
+  unsigned int upperBandwidth() const {return _ku;}
+  unsigned int borderSize() const {return _m;}
+
+protected:
+  double & band(unsigned int i, unsigned int j) {return _band[i*_width+j+_kl-i];}
+  double band(unsigned int i, unsigned int j) const {return _band[i*_width+j+_kl-i];}
+  void bandSolve(double * x) const;//x of length _nb
+  void order(unsigned int n, const std::vector<unsigned int> & border);
+  void resize();
+  //factor the blocks once A is in _band, B in _x, C in _c and D in _schur
+  bool factorBlocks();
+
+  unsigned int _n;
+  unsigned int _nb;//banded unknowns
+  unsigned int _m;//border unknowns
+  unsigned int _kl;
+  unsigned int _ku;
+  unsigned int _width;//2*kl+ku+1, room for the fill of the row interchanges
+  std::vector<unsigned int> _order;//position -> unknown, banded ones first
+  std::vector<unsigned int> _position;//unknown -> position
+  std::vector<double> _band;//row i holds columns i-kl..i+kl+ku
+  std::vector<unsigned int> _band_piv;
+  std::vector<double> _x;//A^-1 B, column k at k*_nb
+  std::vector<double> _c;//C, row k at k*_nb
+  std::vector<double> _schur;//m*m, row major
+  std::vector<unsigned int> _schur_piv;
+  mutable std::vector<double> _work;
+};
+
+#endif //GBORDEREDBANDLU_H
@@ -0,0 +1,145 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+
+#ifndef G0DCLUSTERSYSTEM_H
+#define G0DCLUSTERSYSTEM_H
+
+#include "GBDFIntegrator.h"
+#include "GGroupNetwork.h"
+#include "GSourceSpectrum.h"
+#include "G0DInput.h"
+#include <string>
+#include <vector>
+
+/**
+ * GGroupScheme with rate tables from a rate policy at a fixed temperature,
+ * the part of GGroup the standalone integrator needs.
+ */
+class G0DGroup : public GGroupScheme
+{
+public:
+  G0DGroup(SchemeType scheme, double dr_coef, int Ng_v, int Ng_i, int num_v, int num_i,
+           int v_size, int i_size, int single_v_group, int single_i_group) :
+      GGroupScheme(scheme,dr_coef,Ng_v,Ng_i,num_v,num_i,v_size,i_size,single_v_group,single_i_group)
+  {
+  }
+
+  template<class Rates> void tabulate(const Rates & rates, double T)
+  {
+    GTabulateRates(rates,_max_v,_max_i,_v_size,_i_size,T,_rates);
+    ratesUpdated();
+  }
+};
+
+/**
+ * Spatially homogeneous grouped cluster dynamics of an input deck,
+ * dy/dt = source - residual of the GMobile/GImmobile equations, built from the
+ * [GVariable], [GMobile], [GImmobile], [Sources] and [UserObjects] blocks the
+ * app uses. The unknowns are the group coefficients of the active groups whose
+ * equation is not trivially dL1/dt = 0 (single size groups); the others stay at
+ * their initial value. The L0 of the mobile groups in quasi_steady_v/quasi_steady_i
+ * are algebraic unknowns, 0 = source - residual.
+ */
+class G0DClusterSystem : public GODESystem
+{
+public:
+  G0DClusterSystem(const G0DInput & input);
+  virtual ~G0DClusterSystem();
+
+  virtual unsigned int size() const {return _active.size();}
+  virtual void rhs(double t, const std::vector<double> & y, std::vector<double> & f);
+  virtual void jacobian(double t, const std::vector<double> & y, std::vector<double> & jac);
+  virtual void pattern(std::vector<double> & pattern, std::vector<unsigned int> & border);
+  virtual void algebraic(std::vector<unsigned int> & unknowns) const;
+
+  //solve the balance of the quasi-steady mobile groups for their unknowns in y, the others
+  //fixed, by Newton on the dense block of the mobile groups; consistent values to start from
+  void quasiSteadyState(double t, std::vector<double> & y);
+
+  //keep the sources at their value at time t, up to nextSourceSwitch(t): the steps are taken
+  //between the switches, so that no step straddles a source turning on or off
+  void holdSources(double t);
+  double nextSourceSwitch(double t) const;
+
+  //initial condition of the unknowns from the GVariable block
+  void initialCondition(std::vector<double> & y) const;
+  //size distribution for the unknowns y, used by variableValue()
+  void setSolution(const std::vector<double> & y);
+  //with update = true in GGroup: adapt the group scheme to the distribution of y, see
+  //GGroupScheme::adaptGroupScheme(); with active_range = true: extend the active groups, see
+  //GGroupScheme::extendActiveGroups(). y is remapped to the new unknowns, false if they were kept;
+  //previous: unknown each new one was (-1: joined at zero), empty if the scheme changed
+  bool regroup(std::vector<double> & y, std::vector<int> & previous);
+  //with skip_tolerance > 0 in GGroup: skip the pair reactions of the negligible sizes of y until the
+  //next call, see GGroupScheme::setSignificantSizes()
+  void updateSignificantSizes(const std::vector<double> & y);
+  //pairs skipped and reacting summed over the calls, and the largest bound, see GGroupScheme::skipBound()
+  double skippedPairs() const {return _skipped_pairs;}
+  double reactingPairs() const {return _reacting_pairs;}
+  double skipBound() const {return _skip_bound;}
+  //value of a group variable ("groups0v1") or of an aux variable of GVoidSwelling or
+  //GSumSIAClusterDensity, false if the variable is unknown
+  bool variableValue(const std::string & var, double & value) const;
+
+  const GGroupScheme & groupScheme() const {return *_group;}
+
+protected:
+  //nonzero rate of a spectrum in the current scheme
+  struct Source
+  {
+    unsigned int eq;//GGroupNetwork::index()
+    unsigned int unknown;
+    double value;
+    unsigned int spectrum;
+  };
+  struct SIADensity
+  {
+    std::string var;
+    int lower;
+    int upper;
+    double scale;
+  };
+
+  void setMaterial(const G0DInput & input, const std::string & block, double T);
+  void addSources(const G0DInput & input, const std::string & block);
+  //full coefficient vector from the unknowns
+  void expand(const std::vector<double> & y);
+  //unknowns of the current scheme, every equation with a nonzero residual scale
+  void setActive();
+
+  G0DGroup * _group;
+  GGroupNetwork * _network;
+  std::string _var;//name of the GVariable block, prefix of the group variables
+  int _equations;
+  int _max_mobile_v;
+  int _max_mobile_i;
+  bool _update;
+  double _update_threshold;
+  bool _active_range;
+  double _active_threshold;
+  int _active_buffer;
+  double _skip_tolerance;
+  std::vector<double> _skip_c_v;//distribution the skipped pairs were chosen from
+  std::vector<double> _skip_c_i;
+  double _skipped_pairs;
+  double _reacting_pairs;
+  double _skip_bound;
+  std::vector<unsigned int> _quasi_steady;//GGroupNetwork::index() of the quasi-steady L0
+  std::vector<unsigned int> _active;//unknown -> GGroupNetwork::index()
+  std::vector<double> _u0;//all group coefficients at the start
+  std::vector<double> _u;//all group coefficients
+  std::vector<double> _res;
+  std::vector<double> _jac;//network jacobian, all coefficients
+  std::vector<GSourceSpectrum> _spectra;//of the [Sources] blocks
+  std::vector<double> _source_on;//profile of every spectrum, see holdSources()
+  std::vector<Source> _sources;
+  std::vector<std::string> _swelling_vars;
+  std::vector<SIADensity> _sia_vars;
+};
+
+#endif //G0DCLUSTERSYSTEM_H
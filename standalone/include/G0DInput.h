@@ -0,0 +1,104 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+
+#ifndef G0DINPUT_H
+#define G0DINPUT_H
+
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * Reader for the hit/GetPot input files of Geminio, so the standalone
+ * 0D integrator runs the same decks as the app. Every "name = value" is
+ * stored under its block path, e.g. "UserObjects/material/type"; a parameter
+ * missing from its block is looked up in [GlobalParams], as in MOOSE.
+ * Block and parameter errors throw std::runtime_error.
+ */
+class G0DInput
+{
+public:
+  G0DInput(const std::string & file_name);
+
+  const std::string & fileName() const {return _file_name;}
+  //command line override "Block/name=value" as the app takes it, Block an existing block
+  void setParam(const std::string & override_arg);
+
+  //raw value of block/name or GlobalParams/name
+  bool isParamValid(const std::string & block, const std::string & name) const;
+  std::string getRaw(const std::string & block, const std::string & name) const;
+
+  template<typename T> T getParam(const std::string & block, const std::string & name) const;
+  template<typename T> T getParam(const std::string & block, const std::string & name, const T & def) const;
+  template<typename T> std::vector<T> getVectorParam(const std::string & block, const std::string & name) const;
+
+  bool hasBlock(const std::string & block) const;
+  //direct sub blocks of block, in input order
+  std::vector<std::string> subBlocks(const std::string & block) const;
+  //sub block of block with the given type, "" if none
+  std::string findSubBlock(const std::string & block, const std::string & type) const;
+
+private:
+  std::string _file_name;
+  std::map<std::string, std::string> _params;
+  std::vector<std::string> _blocks;//full path of every block, in input order
+};
+
+template<typename T>
+T
+G0DInput::getParam(const std::string & block, const std::string & name) const
+{
+  std::istringstream iss(getRaw(block,name));
+  T value;
+  if(!(iss >> value))
+    throw std::runtime_error("cannot read " + block + "/" + name + " from " + _file_name);
+  return value;
+}
+
+template<>
+inline std::string
+G0DInput::getParam<std::string>(const std::string & block, const std::string & name) const
+{
+  return getRaw(block,name);
+}
+
+template<>
+inline bool
+G0DInput::getParam<bool>(const std::string & block, const std::string & name) const
+{
+  std::string value = getRaw(block,name);
+  if(value == "true" || value == "1") return true;
+  if(value == "false" || value == "0") return false;
+  throw std::runtime_error("cannot read " + block + "/" + name + " from " + _file_name);
+}
+
+template<typename T>
+T
+G0DInput::getParam(const std::string & block, const std::string & name, const T & def) const
+{
+  return isParamValid(block,name)? getParam<T>(block,name) : def;
+}
+
+template<typename T>
+std::vector<T>
+G0DInput::getVectorParam(const std::string & block, const std::string & name) const
+{
+  std::vector<T> values;
+  if(!isParamValid(block,name)) return values;
+  std::istringstream iss(getRaw(block,name));
+  T value;
+  while(iss >> value)
+    values.push_back(value);
+  if(!iss.eof())
+    throw std::runtime_error("cannot read " + block + "/" + name + " from " + _file_name);
+  return values;
+}
+
+#endif //G0DINPUT_H
@@ -0,0 +1,111 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+
+#ifndef GBDFINTEGRATOR_H
+#define GBDFINTEGRATOR_H
+
+#include "GBorderedBandLU.h"
+#include <deque>
+#include <vector>
+
+/**
+ * Stiff system dy/dt = f(t,y) for GBDFIntegrator
+ */
+class GODESystem
+{
+public:
+  virtual ~GODESystem(){}
+
+  virtual unsigned int size() const = 0;
+  virtual void rhs(double t, const std::vector<double> & y, std::vector<double> & f) = 0;
+  //df/dy, row major size()*size()
+  virtual void jacobian(double t, const std::vector<double> & y, std::vector<double> & jac) = 0;
+  //nonzero pattern of the jacobian and the unknowns coupled to all others, see GBorderedBandLU
+  virtual void pattern(std::vector<double> & pattern, std::vector<unsigned int> & border) = 0;
+  //unknowns without time derivative, 0 = f_k(t,y) with df_k/dy_k invertible
+  virtual void algebraic(std::vector<unsigned int> & unknowns) const {unknowns.clear();}
+};
+
+/**
+ * Variable order (1-5), variable step BDF integrator with modified Newton
+ * iterations. The BDF coefficients are recomputed from the actual step
+ * history, so changing the step needs no interpolation; the local error of
+ * order k is estimated from the difference to the polynomial predictor and
+ * the order follows the smallest estimated error of orders k-1, k, k+1.
+ * Jacobians and factorizations are kept as long as Newton converges.
+ * Algebraic unknowns of the system are solved with the others in every step,
+ * their local error follows from the differential ones and is not controlled.
+ */
+class GBDFIntegrator
+{
+public:
+  GBDFIntegrator(GODESystem & system, double rtol, double atol, unsigned int max_order = 5);
+
+  void setStepBounds(double dtmin, double dtmax);
+  //start (or restart at order 1) from y0, reading size and pattern of the system again
+  void initialize(double t0, const std::vector<double> & y0, double dt0);
+  //the system gained unknowns that were held at zero: new unknown k was unknown previous[k],
+  //or is new with previous[k] < 0. The history is padded with zeros, order and step are kept
+  void extend(const std::vector<int> & previous);
+  //take one accepted step, never past tout; false if the step fell below dtmin or roundoff
+  bool step(double tout);
+
+  double time() const {return _t.front();}
+  const std::vector<double> & solution() const {return _y.front();}
+  unsigned int order() const {return _order;}
+  double stepSize() const {return _h;}
+  const GBorderedBandLU & linearSolver() const {return _lu;}
+
+  unsigned int _n_steps;
+  unsigned int _n_rejected;
+  unsigned int _n_newton;
+  unsigned int _n_jacobians;
+  unsigned int _n_factors;
+
+protected:
+  //size and pattern of the system, work vectors
+  void setup();
+  //derivative at nodes[0] of the polynomial through the nodes, as weights of the node values
+  static void bdfCoefficients(const std::vector<double> & nodes, std::vector<double> & w);
+  //value at t of the polynomial through the k+1 latest points
+  void predict(double t, unsigned int k, std::vector<double> & y) const;
+  //weighted root mean square with the weights of the current step, of all or of the differential unknowns
+  double wrmsNorm(const std::vector<double> & v, bool differential = false) const;
+  bool newton(double t, double a0, const std::vector<double> & psi, std::vector<double> & y);
+  bool updateMatrix(double t, double a0, const std::vector<double> & y, bool new_jacobian);
+
+  GODESystem & _system;
+  unsigned int _size;
+  double _rtol;
+  double _atol;
+  unsigned int _max_order;
+  double _dtmin;
+  double _dtmax;
+  std::vector<double> _mass;//1 for the differential unknowns, 0 for the algebraic ones
+  unsigned int _n_differential;
+
+  std::deque<double> _t;//accepted times, latest first
+  std::deque<std::vector<double> > _y;
+  std::vector<double> _f0;//dy/dt at the start, predictor of the first step
+  double _h;
+  unsigned int _order;
+  unsigned int _steps_at_order;//steps since the last order change
+  std::vector<double> _d_prev;//corrector - predictor of the last step
+  double _h_prev;
+
+  std::vector<double> _jac;
+  unsigned int _jac_age;//steps since _jac was evaluated
+  double _a0_factored;//leading coefficient of the factored matrix, 0 if none
+  std::vector<double> _mat;
+  GBorderedBandLU _lu;
+
+  std::vector<double> _weight;//1/(rtol*|y|+atol) of the latest solution
+  std::vector<double> _ypred, _ylow, _f, _dy, _d, _psi, _a, _nodes;
+};
+
+#endif //GBDFINTEGRATOR_H